@@ -0,0 +1,238 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar binary cache for pre-parsed benchmark files
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "BenchmarkCache.hpp"
+// POSIX process id, for temporary cache files
+#include <unistd.h>
+// required Corblivar headers
+#include "TokenStream.hpp"
+
+// memory allocation
+constexpr char BenchmarkCache::MAGIC[];
+constexpr unsigned BenchmarkCache::VERSION;
+
+unsigned long long BenchmarkCache::hashFile(std::string const& file) {
+	TokenStream in;
+	unsigned long long hash;
+	char const* data;
+
+	in.open(file);
+
+	if (!in.is_open()) {
+		return 0;
+	}
+
+	// FNV-1a, 64 bit
+	hash = 14695981039346656037ULL;
+	data = in.data();
+	for (std::size_t i = 0; i < in.size(); i++) {
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+void BenchmarkCache::init(std::array<unsigned long long, SOURCES> const& hashes) {
+
+	this->clear();
+	this->hashes = hashes;
+}
+
+void BenchmarkCache::clear() {
+
+	this->loaded = false;
+	this->soft_blocks = this->hard_blocks = this->terminals = this->nets = 0;
+
+	// swap w/ empty containers in order to actually release memory
+	std::vector<BlockRecord>().swap(this->blocks);
+	std::vector<std::string>().swap(this->blocks_ids);
+	std::vector<unsigned>().swap(this->nets_offsets);
+	std::vector<NetPin>().swap(this->nets_pins);
+	std::vector<std::string>().swap(this->unresolved_pins);
+	std::vector<AlignmentRecord>().swap(this->alignments);
+}
+
+bool BenchmarkCache::read(char const*& cur, char const* end, void* value, std::size_t const& size) {
+
+	if (static_cast<std::size_t>(end - cur) < size) {
+		return false;
+	}
+
+	std::memcpy(value, cur, size);
+	cur += size;
+
+	return true;
+}
+
+// arrays of PODs are preceded by their size
+template<typename T>
+bool BenchmarkCache::readArray(char const*& cur, char const* end, std::vector<T>& container) {
+	unsigned long long size;
+
+	if (!BenchmarkCache::read(cur, end, &size, sizeof(size)) || static_cast<std::size_t>(end - cur) / sizeof(T) < size) {
+		return false;
+	}
+
+	container.resize(size);
+	return BenchmarkCache::read(cur, end, container.data(), size * sizeof(T));
+}
+
+template<typename T>
+void BenchmarkCache::writeArray(std::ofstream& out, std::vector<T> const& container) {
+	unsigned long long size = container.size();
+
+	out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+	out.write(reinterpret_cast<char const*>(container.data()), size * sizeof(T));
+}
+
+// strings are preceded by their length, and the array of strings by its size
+bool BenchmarkCache::readStrings(char const*& cur, char const* end, std::vector<std::string>& strings) {
+	unsigned long long size;
+	unsigned length;
+
+	if (!BenchmarkCache::read(cur, end, &size, sizeof(size))) {
+		return false;
+	}
+
+	strings.clear();
+	for (unsigned long long s = 0; s < size; s++) {
+
+		if (!BenchmarkCache::read(cur, end, &length, sizeof(length)) || static_cast<std::size_t>(end - cur) < length) {
+			return false;
+		}
+
+		strings.emplace_back(cur, length);
+		cur += length;
+	}
+
+	return true;
+}
+
+void BenchmarkCache::writeStrings(std::ofstream& out, std::vector<std::string> const& strings) {
+	unsigned long long size = strings.size();
+	unsigned length;
+
+	out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+	for (std::string const& s : strings) {
+		length = s.size();
+		out.write(reinterpret_cast<char const*>(&length), sizeof(length));
+		out.write(s.data(), length);
+	}
+}
+
+bool BenchmarkCache::load(std::string const& file) {
+	TokenStream in;
+	char const* cur;
+	char const* end;
+	char magic[sizeof(BenchmarkCache::MAGIC)];
+	unsigned version;
+	std::array<unsigned long long, SOURCES> hashes;
+
+	in.open(file);
+	if (!in.is_open() || in.size() == 0) {
+		return false;
+	}
+
+	cur = in.data();
+	end = cur + in.size();
+
+	// header; version and hashes have to match
+	if (!BenchmarkCache::read(cur, end, magic, sizeof(magic)) || std::memcmp(magic, BenchmarkCache::MAGIC, sizeof(magic)) != 0) {
+		return false;
+	}
+	if (!BenchmarkCache::read(cur, end, &version, sizeof(version)) || version != BenchmarkCache::VERSION) {
+		return false;
+	}
+	if (!BenchmarkCache::read(cur, end, hashes.data(), sizeof(hashes)) || hashes != this->hashes) {
+		return false;
+	}
+
+	// records
+	if (!(
+		BenchmarkCache::read(cur, end, &this->soft_blocks, sizeof(this->soft_blocks)) &&
+		BenchmarkCache::read(cur, end, &this->hard_blocks, sizeof(this->hard_blocks)) &&
+		BenchmarkCache::read(cur, end, &this->terminals, sizeof(this->terminals)) &&
+		BenchmarkCache::read(cur, end, &this->nets, sizeof(this->nets)) &&
+		BenchmarkCache::readArray(cur, end, this->blocks) &&
+		BenchmarkCache::readStrings(cur, end, this->blocks_ids) &&
+		BenchmarkCache::readArray(cur, end, this->nets_offsets) &&
+		BenchmarkCache::readArray(cur, end, this->nets_pins) &&
+		BenchmarkCache::readStrings(cur, end, this->unresolved_pins) &&
+		BenchmarkCache::readArray(cur, end, this->alignments) &&
+		cur == end &&
+		this->blocks.size() == this->blocks_ids.size()
+	     )) {
+
+		this->clear();
+		return false;
+	}
+
+	this->loaded = true;
+
+	if (BenchmarkCache::DBG) {
+		std::cout << "DBG_CACHE> Loaded " << file << "; " << this->blocks.size() << " blocks/pins, ";
+		std::cout << this->nets_pins.size() << " net pins, " << this->alignments.size() << " alignment requests" << std::endl;
+	}
+
+	return true;
+}
+
+bool BenchmarkCache::write(std::string const& file) const {
+	std::ofstream out;
+	std::string tmp_file;
+
+	// write into temporary file first, then replace actual file
+	tmp_file = file + ".tmp." + std::to_string(getpid());
+	out.open(tmp_file.c_str(), std::ios::binary | std::ios::trunc);
+	if (!out.is_open()) {
+		return false;
+	}
+
+	// header
+	out.write(BenchmarkCache::MAGIC, sizeof(BenchmarkCache::MAGIC));
+	out.write(reinterpret_cast<char const*>(&BenchmarkCache::VERSION), sizeof(BenchmarkCache::VERSION));
+	out.write(reinterpret_cast<char const*>(this->hashes.data()), sizeof(this->hashes));
+
+	// records
+	out.write(reinterpret_cast<char const*>(&this->soft_blocks), sizeof(this->soft_blocks));
+	out.write(reinterpret_cast<char const*>(&this->hard_blocks), sizeof(this->hard_blocks));
+	out.write(reinterpret_cast<char const*>(&this->terminals), sizeof(this->terminals));
+	out.write(reinterpret_cast<char const*>(&this->nets), sizeof(this->nets));
+	BenchmarkCache::writeArray(out, this->blocks);
+	BenchmarkCache::writeStrings(out, this->blocks_ids);
+	BenchmarkCache::writeArray(out, this->nets_offsets);
+	BenchmarkCache::writeArray(out, this->nets_pins);
+	BenchmarkCache::writeStrings(out, this->unresolved_pins);
+	BenchmarkCache::writeArray(out, this->alignments);
+
+	out.close();
+
+	if (out.fail() || std::rename(tmp_file.c_str(), file.c_str()) != 0) {
+		std::remove(tmp_file.c_str());
+		return false;
+	}
+
+	return true;
+}
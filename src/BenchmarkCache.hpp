@@ -0,0 +1,132 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar binary cache for pre-parsed benchmark files
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_BENCHMARKCACHE
+#define _CORBLIVAR_BENCHMARKCACHE
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "CorblivarAlignmentReq.hpp"
+// forward declarations, if any
+
+// Records of benchmark files as parsed, i.e., before any config-dependent derivation
+// like scaling or shaping of blocks; the records are either parsed from the text
+// files or loaded from a binary cache file. The cache is valid as long as the hashes
+// of all source files match.
+class BenchmarkCache {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// PODs, to be declared early on
+	public:
+		// source files: blocks, pins, power density, nets, alignment requests
+		static constexpr unsigned SOURCES = 5;
+
+		enum class BlockType : unsigned char {HARD, SOFT, TERMINAL};
+		struct BlockRecord {
+			BlockType type;
+			// hard blocks: width, height; soft blocks: area, min AR, max
+			// AR; terminal pins: x- and y-coordinate
+			std::array<double, 3> values;
+			// blocks: no power value given; terminal pins: no coordinates
+			// given
+			bool missing;
+			// density in [uW/(um^2)]
+			double power_density;
+		};
+
+		enum class PinType : unsigned char {BLOCK, TERMINAL, UNRESOLVED};
+		struct NetPin {
+			PinType type;
+			// numerical id of block / terminal pin; for unresolved pins,
+			// index of their name
+			unsigned handle;
+		};
+
+		struct AlignmentRecord {
+			CorblivarAlignmentReq::Handling handling;
+			int signals;
+			// numerical ids of blocks, or RBOD::NUMERICAL_ID
+			int s_i, s_j;
+			CorblivarAlignmentReq::Type type_x;
+			double alignment_x;
+			CorblivarAlignmentReq::Type type_y;
+			double alignment_y;
+		};
+
+	// private data, functions
+	private:
+		static constexpr char MAGIC[9] = "CORBCACH";
+		static constexpr unsigned VERSION = 1;
+
+		// helper for binary file handling; reading advances cur and fails for
+		// truncated files
+		static bool read(char const*& cur, char const* end, void* value, std::size_t const& size);
+		static bool readStrings(char const*& cur, char const* end, std::vector<std::string>& strings);
+		static void writeStrings(std::ofstream& out, std::vector<std::string> const& strings);
+		template<typename T>
+		static bool readArray(char const*& cur, char const* end, std::vector<T>& container);
+		template<typename T>
+		static void writeArray(std::ofstream& out, std::vector<T> const& container);
+
+	// public data, functions
+	public:
+		// hashes of source files; 0 for unavailable files
+		std::array<unsigned long long, SOURCES> hashes;
+
+		// flag whether records were loaded from cache file
+		bool loaded = false;
+
+		// counts as given in the files' headers
+		unsigned soft_blocks, hard_blocks, terminals, nets;
+
+		// blocks and terminal pins, in order of blocks file, along w/ their ids
+		std::vector<BlockRecord> blocks;
+		std::vector<std::string> blocks_ids;
+
+		// nets in CSR format, i.e., pins of net n are nets_pins[nets_offsets[n],
+		// nets_offsets[n + 1]); names of unresolved pins for logging
+		std::vector<unsigned> nets_offsets;
+		std::vector<NetPin> nets_pins;
+		std::vector<std::string> unresolved_pins;
+
+		// alignment requests
+		std::vector<AlignmentRecord> alignments;
+
+		// FNV-1a hash of file's content; 0 for unavailable files
+		static unsigned long long hashFile(std::string const& file);
+
+		// reset records, consider hashes of current source files
+		void init(std::array<unsigned long long, SOURCES> const& hashes);
+		// load records from cache file; only successful if cache file matches
+		// version and hashes
+		bool load(std::string const& file);
+		// write records to cache file; the file is replaced atomically, such
+		// that concurrent runs never read partially written files
+		bool write(std::string const& file) const;
+		// release records
+		void clear();
+};
+
+#endif
@@ -50,6 +50,7 @@ class Block {
 	public:
 		Block(std::string const& id) {
 			this->id = id;
+			this->numerical_id = -1;
 			this->layer = -1;
 			this->power_density= 0.0;
 			this->AR.min = AR.max = 1.0;
@@ -63,6 +64,10 @@ class Block {
 	// public data, functions
 	public:
 		std::string id;
+		// dense integer handle, i.e., index of block / pin in its container;
+		// assigned during parsing, to be used for all comparisons of blocks;
+		// -1 for blocks not held in containers, like TSV islands
+		int numerical_id;
 		mutable int layer;
 
 		// flag to monitor placement; also required for alignment handling
@@ -78,7 +83,8 @@ class Block {
 		// density in [uW/(um^2)]
 		double power_density;
 
-		// rectangle, represents block geometry and placement
+		// rectangle, represents block geometry and placement; layout
+		// evaluation considers a snapshot of bb and layer, see BlocksGeometry
 		mutable Rect bb, bb_backup, bb_best;
 
 		// aspect ratio AR, relates to blocks' dimensions by x / y
@@ -152,13 +158,12 @@ class Block {
 			return this->power_density * this->bb.area * 1.0e-6;
 		}
 
-		// search blocks
-		inline static Block const* findBlock(std::string const& id, std::vector<Block> const& container) {
+		// search blocks; via hash index of names to numerical ids
+		inline static Block const* findBlock(std::string const& id, std::vector<Block> const& container, std::unordered_map<std::string, unsigned> const& index) {
+			auto it = index.find(id);
 
-			for (Block const& b : container) {
-				if (b.id == id) {
-					return &b;
-				}
+			if (it != index.end()) {
+				return &container[it->second];
 			}
 
 			return nullptr;
@@ -201,13 +206,12 @@ class Pin : public Block {
 		Pin (std::string const& id) : Block(id) {
 		};
 
-		// search pins
-		inline static Pin const* findPin(std::string const& id, std::vector<Pin> const& container) {
+		// search pins; via hash index of names to numerical ids
+		inline static Pin const* findPin(std::string const& id, std::vector<Pin> const& container, std::unordered_map<std::string, unsigned> const& index) {
+			auto it = index.find(id);
 
-			for (Pin const& b : container) {
-				if (b.id == id) {
-					return &b;
-				}
+			if (it != index.end()) {
+				return &container[it->second];
 			}
 
 			return nullptr;
@@ -223,10 +227,11 @@ class TSV_Island : public Block {
 	// constructors, destructors, if any non-implicit
 	//
 	public:
-		TSV_Island (std::string const& id, int const& TSVs_count, double const& TSV_pitch, Rect const& bb, int const& layer, double width = -1.0) : Block(id) {
+		TSV_Island (std::string const& id, int const& TSVs_count, double const& TSV_pitch, Rect const& bb, int const& layer, double width = -1.0, int const& alignment_req = -1) : Block(id) {
 
 			this->TSVs_count = TSVs_count;
 			this->layer = layer;
+			this->alignment_req = alignment_req;
 			this->bb = bb;
 
 			this->resetOutline(TSV_pitch, width);
@@ -235,6 +240,10 @@ class TSV_Island : public Block {
 	// public data, functions
 	public:
 		int TSVs_count;
+		// id of related alignment request, for islands of vertical buses; the
+		// string id of such islands is only derived for output, see
+		// CorblivarAlignmentReq::busId(); -1 for all other islands
+		int alignment_req;
 
 		// reset TSV group's outline according to area required for given TSVs
 		//
@@ -299,6 +308,7 @@ class RBOD : public Block {
 	// public data, functions
 	public:
 		static constexpr const char* ID = "RBOD";
+		static constexpr int NUMERICAL_ID = -2;
 
 	// constructors, destructors, if any non-implicit
 	//
@@ -307,6 +317,8 @@ class RBOD : public Block {
 	public:
 		RBOD () : Block(ID) {
 
+			this->numerical_id = NUMERICAL_ID;
+
 			this->bb.ll.x = 0.0;
 			this->bb.ll.y = 0.0;
 			this->bb.ur.x = 0.0;
@@ -0,0 +1,60 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar blocks geometry; struct-of-arrays snapshot of layout data
+ *    for layout evaluation
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "BlocksGeometry.hpp"
+// required Corblivar headers
+#include "Block.hpp"
+#include "PhaseTimers.hpp"
+
+void BlocksGeometry::update(std::vector<Block> const& blocks) {
+	unsigned b;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::UPDATE_BLOCKS_GEOMETRY);
+
+	// (re-)init snapshot; static data like the power densities are only copied
+	// once here, since they don't change w/ the layout
+	if (this->layer.size() != blocks.size()) {
+		this->ll_x.resize(blocks.size());
+		this->ll_y.resize(blocks.size());
+		this->ur_x.resize(blocks.size());
+		this->ur_y.resize(blocks.size());
+		this->layer.resize(blocks.size());
+		this->power_density.resize(blocks.size());
+
+		for (b = 0; b < blocks.size(); b++) {
+			this->power_density[b] = blocks[b].power_density;
+		}
+	}
+
+	// copy layout-dependent data
+	for (b = 0; b < blocks.size(); b++) {
+		this->ll_x[b] = blocks[b].bb.ll.x;
+		this->ll_y[b] = blocks[b].bb.ll.y;
+		this->ur_x[b] = blocks[b].bb.ur.x;
+		this->ur_y[b] = blocks[b].bb.ur.y;
+		this->layer[b] = blocks[b].layer;
+	}
+}
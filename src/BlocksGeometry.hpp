@@ -0,0 +1,90 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar blocks geometry; struct-of-arrays snapshot of layout data
+ *    for layout evaluation
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_BLOCKS_GEOMETRY
+#define _CORBLIVAR_BLOCKS_GEOMETRY
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Rect.hpp"
+// forward declarations, if any
+class Block;
+
+// Struct-of-arrays snapshot of the layout data of blocks, indexed like the blocks
+// container. The blocks themselves remain the primary storage of their layout data:
+// layout generation, packing and alignment reach blocks via the placement stacks,
+// the CBL tuples and the alignment requests, i.e., in no contiguous order, and update
+// them in place. Once a layout is generated, its geometry is copied into this
+// snapshot, and the evaluation of the layout, i.e., cost and thermal analysis,
+// traverses the contiguous arrays instead of whole Block objects. The copy is one
+// linear pass for each evaluated layout, see PhaseTimers::UPDATE_BLOCKS_GEOMETRY.
+class BlocksGeometry {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// public data, functions
+	public:
+		// blocks' bb coordinates and layers
+		std::vector<double> ll_x, ll_y, ur_x, ur_y;
+		std::vector<int> layer;
+		// blocks' power densities [uW/(um^2)]; static, but required along w/
+		// the geometry for power maps
+		std::vector<double> power_density;
+
+		// copy geometry of blocks into snapshot
+		void update(std::vector<Block> const& blocks);
+
+		inline unsigned size() const {
+			return this->layer.size();
+		};
+
+		// bb of block b
+		inline Rect bb(unsigned const& b) const {
+			Rect ret;
+
+			ret.ll.x = this->ll_x[b];
+			ret.ll.y = this->ll_y[b];
+			ret.ur.x = this->ur_x[b];
+			ret.ur.y = this->ur_y[b];
+			ret.w = ret.ur.x - ret.ll.x;
+			ret.h = ret.ur.y - ret.ll.y;
+			ret.area = ret.w * ret.h;
+
+			return ret;
+		};
+
+		// check whether block b differs from same block in other snapshot
+		inline bool differs(unsigned const& b, BlocksGeometry const& other) const {
+			return (
+				this->layer[b] != other.layer[b]
+				|| this->ll_x[b] != other.ll_x[b]
+				|| this->ll_y[b] != other.ll_y[b]
+				|| this->ur_x[b] != other.ur_x[b]
+				|| this->ur_y[b] != other.ur_y[b]
+			);
+		};
+};
+
+#endif
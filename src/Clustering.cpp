@@ -27,6 +27,7 @@
 #include "ThermalAnalyzer.hpp"
 #include "Net.hpp"
 #include "Math.hpp"
+#include "PhaseTimers.hpp"
 
 // For clustering, a ``chicken-egg'' problem arises: the clustered TSVs impact the thermal
 // analysis, but for clustering TSVs we require the result of the thermal analysis. Thus,
@@ -46,6 +47,10 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 	std::map<double, Hotspot, std::greater<double>>::iterator it_hotspot;
 	std::list<Cluster>::iterator it_cluster;
 	TSV_Island* TSVi;
+	unsigned t;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::CLUSTER_SIGNAL_TSVS);
 
 	if (Clustering::DBG) {
 		std::cout << "-> Clustering::clusterSignalTSVs(" << &nets << ", " << &nets_segments << ", " << &thermal_analysis << ")" << std::endl;
@@ -257,7 +262,9 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 		//
 		for (it_cluster = this->clusters[i].begin(); it_cluster != this->clusters[i].end(); ++it_cluster) {
 
-			TSVi = new TSV_Island(
+			// construct island in place in global TSVs container; note that
+			// the pointer is valid until the next island is constructed
+			TSVs.emplace_back(
 					// cluster id
 					"net_cluster_" + std::to_string((*it_cluster).nets.size()),
 					// signal / TSV count
@@ -274,6 +281,7 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 					// layer assignment
 					i
 				);
+			TSVi = &TSVs.back();
 
 			// perform greedy shifting in case new island overlaps with any
 			// previous one
@@ -283,7 +291,10 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 
 				shift = false;
 
-				for (TSV_Island const& prev_island : TSVs) {
+				// previous islands, i.e., all but the new one
+				for (t = 0; t < TSVs.size() - 1; t++) {
+
+					TSV_Island& prev_island = TSVs[t];
 
 					if (prev_island.layer != TSVi->layer) {
 						continue;
@@ -297,12 +308,10 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 				}
 			}
 
-			// store in global TSVs container
-			TSVs.push_back(*TSVi);
-
-			// link TSV block to each associated net
+			// link TSV block to each associated net, via index in global
+			// TSVs container
 			for (it_net = (*it_cluster).nets.begin(); it_net != (*it_cluster).nets.end(); ++it_net) {
-				(*it_net)->TSVs.push_back(TSVi);
+				(*it_net)->TSVs.push_back(TSVs.size() - 1);
 			}
 		}
 	}
@@ -317,6 +326,7 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 // based on Lindeberg's grey-level blob detection algorithm.
 void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis) {
 	int x, y;
+	int map_dim;
 	std::vector<ThermalAnalyzer::ThermalMapBin*> thermal_map;
 	std::vector<ThermalAnalyzer::ThermalMapBin*>::iterator it1;
 	std::list<ThermalAnalyzer::ThermalMapBin*> relev_neighbors;
@@ -337,20 +347,23 @@ void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &therm
 		return;
 	}
 
+	// dimension of thermal map
+	map_dim = thermal_analysis.thermal_map->size();
+
 	// reset hotspot regions
 	this->hotspots.clear();
 
 	// reset hotspot associations in the thermal map
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < map_dim; x++) {
+		for (y = 0; y < map_dim; y++) {
 			(*thermal_analysis.thermal_map)[x][y].hotspot_id = ThermalAnalyzer::HOTSPOT_UNDEFINED;
 		}
 	}
 
 	// parse the thermal grid into an list (to be sorted below); data structure for
 	// blob detection
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < map_dim; x++) {
+		for (y = 0; y < map_dim; y++) {
 
 			// ignore bins w/ temperature values near the offset
 			if (Math::doubleComp(thermal_analysis.temp_offset, (*thermal_analysis.thermal_map)[x][y].temp)) {
@@ -592,8 +605,8 @@ void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &therm
 
 		std::cout << "DBG_HOTSPOT> adapted thermal-map:" << std::endl;
 
-		for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-			for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+		for (x = 0; x < map_dim; x++) {
+			for (y = 0; y < map_dim; y++) {
 
 				cur_bin = &(*thermal_analysis.thermal_map)[x][y];
 
@@ -46,6 +46,9 @@ int main (int argc, char** argv) {
 
 	// parse alignment request
 	IO::parseAlignmentRequests(fp, corb.editAlignments());
+	corb.reserveAlignments();
+	// write cache for pre-parsed benchmark, if required
+	IO::writeBenchmarkCache(fp);
 
 	// init thermal analyzer, only reasonable after parsing config file
 	fp.initThermalAnalyzer();
@@ -67,6 +70,11 @@ int main (int argc, char** argv) {
 		// assume read in data as currently best solution
 		corb.storeBestCBLs();
 
+		// fit power-blurring parameters for given solution
+		if (fp.thermalFitting()) {
+			fp.fitThermalParameters(corb);
+		}
+
 		// overall cost is not determined; cost cannot be determined since no
 		// normalization during SA search was performed
 		fp.finalize(corb, false);
@@ -82,7 +90,17 @@ int main (int argc, char** argv) {
 		}
 
 		// perform SA; main handler
-		done = fp.performSA(corb);
+		if (fp.parallelTempering()) {
+			// replicas w/ exchange along temperature ladder
+			done = fp.performParallelTempering(corb);
+		}
+		else if (fp.getReplicas() > 1) {
+			// multiple independent SA replicas, run concurrently
+			done = fp.performSAReplicas(corb);
+		}
+		else {
+			done = fp.performSA(corb);
+		}
 
 		if (fp.logMin()) {
 			std::cout << "Corblivar> ";
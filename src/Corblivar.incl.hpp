@@ -31,9 +31,19 @@
 #include <array>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <utility>
 #include <algorithm>
+#include <random>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <chrono>
 // (TODO) replace w/ chrono
 #include <sys/timeb.h>
 
@@ -42,5 +52,6 @@
 #include <cmath>
 #include <ctime>
 #include <cstdlib>
+#include <cstring>
 
 #endif
@@ -26,13 +26,15 @@
 // required Corblivar headers
 #include "Math.hpp"
 #include "Block.hpp"
+#include "PhaseTimers.hpp"
 
 // memory allocation
 constexpr int CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE;
 
 void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, std::vector<Block> const& blocks, bool const& power_aware_assignment) {
 	Direction cur_dir;
-	int die, cur_t, cur_layer;
+	int die, cur_layer;
+	unsigned cur_t;
 	double blocks_area_per_layer, cur_blocks_area;
 	std::vector<Block> blocks_copy;
 	Block const* cur_block;
@@ -61,7 +63,7 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 		// sort blocks by power density; use local (mutable) copy of blocks
 		sort(blocks_copy.begin(), blocks_copy.end(),
 			// lambda expression
-			[&](Block b1, Block b2) {
+			[&](Block const& b1, Block const& b2) {
 				return b1.power_density < b2.power_density;
 			}
 		    );
@@ -79,7 +81,7 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 	for (Block& cur_block_copy : blocks_copy) {
 
 		// determine related block from original blocks container
-		cur_block = Block::findBlock(cur_block_copy.id, blocks);
+		cur_block = &blocks[cur_block_copy.numerical_id];
 
 		// for power-aware assignment, fill layers w/ (sorted) blocks until the
 		// dies are evenly occupied
@@ -114,12 +116,18 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 		// be placed ``somewhat diagonally'' into outline
 		cur_t = 0;
 
-		// store into separate CBL sequences
-		this->dies[die].CBL.S.push_back(std::move(cur_block));
-		this->dies[die].CBL.L.push_back(std::move(cur_dir));
-		this->dies[die].CBL.T.push_back(std::move(cur_t));
+		// store into CBL
+		this->dies[die].CBL.insert({cur_block, cur_dir, cur_t});
 	}
 
+	// new CBLs; invalidate checkpoints
+	for (CorblivarDie& die : this->dies) {
+		die.invalidateCheckpoints();
+	}
+
+	// new CBLs; init hash
+	this->rehashLayout();
+
 	if (CorblivarCore::DBG) {
 		for (CorblivarDie const& die : this->dies) {
 			std::cout << "DBG_CORE> ";
@@ -136,12 +144,59 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 	}
 }
 
+#ifdef DBG_ALLOCATIONS
+// debugging allocation counter; replaces global operator new, counts allocations per
+// thread; enabled via according Makefile option
+static thread_local unsigned long allocations = 0;
+
+void* operator new(std::size_t size) {
+	void* ptr;
+
+	allocations++;
+
+	ptr = std::malloc(size == 0 ? 1 : size);
+	if (ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+#endif
+
+unsigned long long CorblivarCore::determLayoutHash() const {
+	unsigned long long ret;
+	unsigned t, r;
+
+	ret = 0;
+
+	for (CorblivarDie const& die : this->dies) {
+
+		for (t = 0; t < die.CBL.size(); t++) {
+			ret ^= this->tupleKey(die, t);
+			ret ^= CorblivarCore::shapeKey(die.CBL.tuples[t].S);
+		}
+	}
+
+	for (r = 0; r < this->A.size(); r++) {
+		ret ^= this->alignmentKey(r);
+	}
+
+	return ret;
+}
+
 bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	Block const* cur_block;
 	Block const* other_block;
-	std::vector<CorblivarAlignmentReq const*> cur_block_alignment_reqs;
 	CorblivarAlignmentReq const* req_processed;
 
+#ifdef DBG_ALLOCATIONS
+	unsigned long allocations_start = allocations;
+#endif
+
 	if (CorblivarCore::DBG) {
 		std::cout << "DBG_CORE> ";
 		std::cout << "Performing layout generation..." << std::endl;
@@ -150,13 +205,22 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	// init die pointer
 	this->p = &this->dies[0];
 
-	// reset die data, i.e., layout generation handler data
+	// reset die data, i.e., layout generation handler data; w/o alignment, the
+	// layout generation can be resumed from the checkpoint nearest to the lowest
+	// modified tuple, since all previous tuples are placed just as before
 	for (CorblivarDie& die : this->dies) {
-		die.reset();
+
+		if (perform_alignment) {
+			die.reset();
+		}
+		else {
+			die.resetToCheckpoint();
+		}
 	}
 
-	// reset alignments-in-process list
-	AL.clear();
+	// reset alignments-in-process list; retains memory reserved by
+	// reserveAlignments
+	this->AL.clear();
 
 	if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
 		std::cout << "DBG_ALIGNMENT>" << std::endl;
@@ -212,13 +276,13 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 			if (perform_alignment) {
 
 				// determine related requests for current block
-				cur_block_alignment_reqs = this->findAlignmentReqs(cur_block);
+				this->findAlignmentReqs(cur_block, this->block_alignment_reqs);
 
 				// some requests are given, handle them stepwise
-				if (!cur_block_alignment_reqs.empty()) {
+				if (!this->block_alignment_reqs.empty()) {
 
 					// handle each request
-					for (auto* cur_req : cur_block_alignment_reqs) {
+					for (auto* cur_req : this->block_alignment_reqs) {
 
 						if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
 							std::cout << "DBG_ALIGNMENT>  Handling alignment request for block " << cur_block->id << std::endl;
@@ -226,7 +290,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 						}
 
 						// determine other block of request
-						if (cur_req->s_i->id == cur_block->id) {
+						if (cur_req->s_i->numerical_id == cur_block->numerical_id) {
 							other_block = cur_req->s_j;
 						}
 						else {
@@ -281,7 +345,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 							// request; only applicable for
 							// regular blocks, i.e., for RBOD,
 							// continue on current die
-							if (other_block->id != RBOD::ID) {
+							if (other_block->numerical_id != RBOD::NUMERICAL_ID) {
 								this->p = &this->dies[other_block->layer];
 							}
 
@@ -294,7 +358,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 						// request is processed; drop from list of
 						// requests-in-process
 						else {
-							this->AL.remove(req_processed);
+							this->AL.erase(std::remove(this->AL.begin(), this->AL.end(), req_processed), this->AL.end());
 						}
 					}
 
@@ -327,11 +391,28 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 		}
 	}
 
+	// update checkpoint handling; w/ alignment, blocks may have been shifted and
+	// no checkpoints are memorized, thus invalidate them; otherwise, the
+	// checkpoints are valid for the whole CBL now
+	for (CorblivarDie& die : this->dies) {
+
+		if (perform_alignment) {
+			die.invalidateCheckpoints();
+		}
+		else {
+			die.markUnmodified();
+		}
+	}
+
 	if (CorblivarCore::DBG) {
 		std::cout << "DBG_CORE> ";
 		std::cout << "Done" << std::endl;
 	}
 
+#ifdef DBG_ALLOCATIONS
+	std::cout << "DBG_ALLOCATIONS> Heap allocations during layout generation: " << allocations - allocations_start << std::endl;
+#endif
+
 	return true;
 }
 
@@ -340,11 +421,13 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	Block const* b2;
 	CorblivarDie* die_b1;
 	CorblivarDie* die_b2;
-	std::list<Block const*> b1_relev_blocks, b2_relev_blocks;
 	Direction dir_b1, dir_b2;
 	bool b1_shifted, b2_shifted;
 	bool b1_to_shift_horizontal, b1_to_shift_vertical, b2_to_shift_horizontal, b2_to_shift_vertical;
 
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::ALIGN_BLOCKS);
+
 	// scenario I: both blocks are yet unplaced
 	if (!req->s_i->placed && !req->s_j->placed) {
 
@@ -361,8 +444,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		die_b2 = &this->dies[b2->layer];
 
 		// pop relevant blocks from related placement stacks
-		b1_relev_blocks = die_b1->popRelevantBlocks();
-		b2_relev_blocks = die_b2->popRelevantBlocks();
+		die_b1->popRelevantBlocks(this->b1_relev_blocks);
+		die_b2->popRelevantBlocks(this->b2_relev_blocks);
 
 		// first, we need to determine which insertion direction is to be applied
 		// for each block
@@ -385,8 +468,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				}
 
 				// first, determine blocks' y-coordinates
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks);
 
 				// perform shift in y-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req);
@@ -395,8 +478,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// second, determine block's x-coordinates (depends on
 				// y-coord of relevant blocks and, more generally, on
 				// previously placed, possibly shifted blocks)
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks, true);
 
 				// perform shift in x-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req) || b1_shifted;
@@ -411,8 +494,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				}
 
 				// first, determine blocks' x-coordinates
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks);
 
 				// perform shift in x-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req);
@@ -421,8 +504,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// second, determine block's y-coordinates (depends on
 				// x-coord of relevant blocks and, more generally, on
 				// previously placed, possibly shifted blocks)
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks, true);
 
 				// perform shift in y-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req) || b1_shifted;
@@ -440,20 +523,20 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 
 			// initially, determine all coordinates
 			if (dir_b1 == Direction::HORIZONTAL) {
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
 			}
 			else {
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
 			}
 			if (dir_b2 == Direction::HORIZONTAL) {
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks, true);
 			}
 			else {
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks, true);
 			}
 
 			// second, determine which block is to be shifted in which direction
@@ -471,7 +554,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// perform shifting of b1; helper also considers to shift
 				// b2 if required
 				CorblivarCore::sequentialShiftingHelper(
-						die_b1, die_b2, req, b1_relev_blocks, b2_relev_blocks, dir_b1, b1_shifted, b2_shifted);
+						die_b1, die_b2, req, this->b1_relev_blocks, this->b2_relev_blocks, dir_b1, b1_shifted, b2_shifted);
 			}
 
 			else if (b2_to_shift_horizontal && b2_to_shift_vertical) {
@@ -479,7 +562,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// perform shifting of b2; helper also considers to shift
 				// b1 if required
 				CorblivarCore::sequentialShiftingHelper(
-						die_b2, die_b1, req, b2_relev_blocks, b1_relev_blocks, dir_b2, b2_shifted, b1_shifted);
+						die_b2, die_b1, req, this->b2_relev_blocks, this->b1_relev_blocks, dir_b2, b2_shifted, b1_shifted);
 			}
 
 			// b) one or both blocks are to be shifted in their first direction
@@ -518,18 +601,18 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// since the corner-block front in both dimensions may be different now
 		//
 		if (b1_shifted) {
-			die_b1->rebuildPlacementStacks(b1_relev_blocks);
+			die_b1->rebuildPlacementStacks(this->b1_relev_blocks);
 		}
 		// if a block was not shifted, we can simply update the placement stacks
 		else {
-			die_b1->updatePlacementStacks(b1_relev_blocks);
+			die_b1->updatePlacementStacks(this->b1_relev_blocks);
 		}
 
 		if (b2_shifted) {
-			die_b2->rebuildPlacementStacks(b2_relev_blocks);
+			die_b2->rebuildPlacementStacks(this->b2_relev_blocks);
 		}
 		else {
-			die_b2->updatePlacementStacks(b2_relev_blocks);
+			die_b2->updatePlacementStacks(this->b2_relev_blocks);
 		}
 
 		// mark (shifted) blocks as placed
@@ -575,7 +658,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// sanity check for diff b/w current CBL tuple and current block; that's
 		// happening when the block to be shifted is not the current block, i.e.,
 		// a block to be processed later on; thus, we skip the alignment for now
-		if (b1->id != die_b1->getCurrentBlock()->id) {
+		if (b1->numerical_id != die_b1->getCurrentBlock()->numerical_id) {
 
 			if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
 				std::cout << "DBG_ALIGNMENT>     Shift block is not current block; abort alignment" << std::endl;
@@ -585,7 +668,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		}
 
 		// pop relevant blocks from related placement stack
-		b1_relev_blocks = die_b1->popRelevantBlocks();
+		die_b1->popRelevantBlocks(this->b1_relev_blocks);
 
 		// horizontal placement
 		if (die_b1->getCurrentDirection() == Direction::HORIZONTAL) {
@@ -596,7 +679,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			}
 
 			// first, determine block's y-coordinates
-			die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
+			die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
 
 			// perform shift in y-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req);
@@ -604,7 +687,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			// second, determine block's x-coordinates (depends on y-coord of
 			// relevant blocks and, more generally, on previously placed,
 			// possibly shifted blocks)
-			die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
+			die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
 
 			// perform shift in x-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req) || b1_shifted;
@@ -618,7 +701,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			}
 
 			// first, determine block's x-coordinates
-			die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
+			die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
 
 			// perform shift in x-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req);
@@ -626,7 +709,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			// second, determine block's y-coordinates (depends on x-coord of
 			// relevant blocks and, more generally, on previously placed,
 			// possibly shifted blocks)
-			die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
+			die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
 
 			// perform shift in y-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req) || b1_shifted;
@@ -635,11 +718,11 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// if the block was shifted, we need to rebuild the placement stacks since
 		// the corner-block front in both dimensions may be different now
 		if (b1_shifted) {
-			die_b1->rebuildPlacementStacks(b1_relev_blocks);
+			die_b1->rebuildPlacementStacks(this->b1_relev_blocks);
 		}
 		// if the block was not shifted, we can simply update the placement stacks
 		else {
-			die_b1->updatePlacementStacks(b1_relev_blocks);
+			die_b1->updatePlacementStacks(this->b1_relev_blocks);
 		}
 
 		// mark shifted block as placed
@@ -654,7 +737,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	return true;
 }
 
-void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, std::list<Block const*> b1_relev_blocks, std::list<Block const*> b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
+void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, std::vector<Block const*> const& b1_relev_blocks, std::vector<Block const*> const& b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
 
 	// annotate that b1 is shifted at least in one direction
 	b1_shifted = true;
@@ -742,18 +825,20 @@ void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie*
 	}
 }
 
-std::vector<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block const* b) const {
-	std::vector<CorblivarAlignmentReq const*> ret;
+void CorblivarCore::findAlignmentReqs(Block const* b, std::vector<CorblivarAlignmentReq const*>& reqs) const {
+
+	// reset buffer; capacity is retained
+	reqs.clear();
 
 	// sanity check for no given requests
 	if (this->A.empty()) {
-		return ret;
+		return;
 	}
 
 	// determine requests covering the given block
 	for (CorblivarAlignmentReq const& req : this->A) {
 
-		if (req.s_i->id == b->id || req.s_j->id == b->id) {
+		if (req.s_i->numerical_id == b->numerical_id || req.s_j->numerical_id == b->numerical_id) {
 
 			// only consider request which are still in
 			// process, i.e., not both blocks are placed yet
@@ -763,7 +848,7 @@ std::vector<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block
 					std::cout << "DBG_ALIGNMENT>  Unhandled request: " << req.tupleString() << std::endl;
 				}
 
-				ret.push_back(&req);
+				reqs.push_back(&req);
 			}
 		}
 	}
@@ -771,20 +856,15 @@ std::vector<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block
 	// requests w/ placed blocks are considered first; eases handling
 	// of alignment requests such that blocks ready for alignment are
 	// placed/aligned first
-	sort(ret.begin(), ret.end(),
+	sort(reqs.begin(), reqs.end(),
 		// lambda expression
 		[&](CorblivarAlignmentReq const* req1, CorblivarAlignmentReq const* req2) {
 			return (req1->s_i->placed || req1->s_j->placed) && (!req2->s_i->placed && !req2->s_j->placed);
 		}
 	);
-
-	return ret;
 }
 
 void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
-	std::vector<std::vector<CornerBlockList::Tuple>> tuples;
-	std::vector<CornerBlockList::Tuple> tuples_die;
-	CornerBlockList::Tuple cur_tuple;
 
 	// log
 	if (log) {
@@ -798,33 +878,16 @@ void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
 		}
 	}
 
-	// construct temp vectors w/ CBL tuples, assign separate CBL sequences to tuple vectors
-	for (CorblivarDie& die : this->dies) {
-
-		tuples_die.clear();
-
-		for (unsigned t = 0; t < die.CBL.size(); t++) {
-
-			cur_tuple.S = std::move(die.CBL.S[t]);
-			cur_tuple.L = std::move(die.CBL.L[t]);
-			cur_tuple.T = std::move(die.CBL.T[t]);
-
-			tuples_die.push_back(std::move(cur_tuple));
-		}
-
-		tuples.push_back(std::move(tuples_die));
-	}
-
 	// perfom sorting
 	switch (mode) {
 
 		// sort tuple vector by blocks size, in descending order
 		case CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE:
 
-			for (auto& tuples_die : tuples) {
-				sort(tuples_die.begin(), tuples_die.end(),
+			for (CorblivarDie& die : this->dies) {
+				sort(die.CBL.tuples.begin(), die.CBL.tuples.end(),
 					// lambda expression to provide compare function
-					[&](CornerBlockList::Tuple t1, CornerBlockList::Tuple t2) {
+					[&](CornerBlockList::Tuple const& t1, CornerBlockList::Tuple const& t2) {
 						return t1.S->bb.area > t2.S->bb.area;
 					}
 				);
@@ -833,20 +896,14 @@ void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
 			break;
 	}
 
-	// reassign CBL sequences from tuple vectors
-	unsigned d = 0;
+	// reordered CBLs; invalidate checkpoints
 	for (CorblivarDie& die : this->dies) {
-
-		for (unsigned t = 0; t < die.CBL.size(); t++) {
-
-			die.CBL.S[t] = std::move(tuples[d][t].S);
-			die.CBL.L[t] = std::move(tuples[d][t].L);
-			die.CBL.T[t] = std::move(tuples[d][t].T);
-		}
-
-		d++;
+		die.invalidateCheckpoints();
 	}
 
+	// reordered CBLs; re-init hash
+	this->rehashLayout();
+
 	// log
 	if (log) {
 		std::cout << "Corblivar> ";
@@ -28,6 +28,7 @@
 // Corblivar includes, if any
 #include "CorblivarDie.hpp"
 #include "CorblivarAlignmentReq.hpp"
+#include "Math.hpp"
 // forward declarations, if any
 class Block;
 
@@ -71,18 +72,74 @@ class CorblivarCore {
 		// sequence A; alignment requests
 		std::vector<CorblivarAlignmentReq> A;
 
-		// alignments-in-process list
-		std::list<CorblivarAlignmentReq const*> AL;
+		// alignments-in-process list; contiguous and reserved for all requests,
+		// see generateLayout
+		std::vector<CorblivarAlignmentReq const*> AL;
+
+		// buffer for requests covering the block in process; reserved for all
+		// requests, see generateLayout
+		std::vector<CorblivarAlignmentReq const*> block_alignment_reqs;
+
+		// buffers for relevant blocks during block alignment; pre-reserved
+		std::vector<Block const*> b1_relev_blocks, b2_relev_blocks;
+
+		// Zobrist hash of the layout, i.e., of the CBL tuples of all dies, of
+		// the blocks' shapes, and of the alignment requests' coordinates;
+		// maintained incrementally by the layout-modification operations: the
+		// keys of affected features are removed before and added again after
+		// each modification, both via XOR
+		unsigned long long layout_hash;
+
+		// Zobrist keys; tuples are keyed along w/ their predecessors on the
+		// same die, thus shifting of tuples by insertion or removal of other
+		// tuples only affects the keys in the direct neighborhood
+		inline unsigned long long tupleKey(CorblivarDie const& die, unsigned const& tuple) const {
+			unsigned long long key;
+
+			key = Math::hash64(die.id + 1);
+			key = Math::hash64(key ^ (tuple == 0 ? ~0ULL : die.CBL.tuples[tuple - 1].S->numerical_id));
+			key = Math::hash64(key ^ die.CBL.tuples[tuple].S->numerical_id);
+			key = Math::hash64(key ^ ((static_cast<unsigned long long>(die.CBL.tuples[tuple].L) << 32) | die.CBL.tuples[tuple].T));
+
+			return key;
+		};
+		inline static unsigned long long shapeKey(Block const* b) {
+			unsigned long long key;
+
+			key = Math::hash64(~static_cast<unsigned long long>(b->numerical_id));
+			key = Math::hash64(key ^ Math::doubleBits(b->bb.w));
+			key = Math::hash64(key ^ Math::doubleBits(b->bb.h));
+
+			return key;
+		};
+		inline unsigned long long alignmentKey(unsigned const& req) const {
+			unsigned long long key;
+
+			key = Math::hash64(~static_cast<unsigned long long>(req) << 32);
+			key = Math::hash64(key ^ static_cast<unsigned long long>(this->A[req].type_x));
+			key = Math::hash64(key ^ Math::doubleBits(this->A[req].alignment_x));
+
+			return key;
+		};
+
+		// hashing helper; toggle keys of the tuples first to last, where
+		// tuples beyond the CBL are ignored
+		inline void hashTuples(int const& die, int const& first, int const& last) {
+
+			for (int t = std::max(0, first); t <= std::min(last, static_cast<int>(this->dies[die].CBL.size()) - 1); t++) {
+				this->layout_hash ^= this->tupleKey(this->dies[die], t);
+			}
+		};
 
 		// handler for block alignment
 		bool alignBlocks(CorblivarAlignmentReq const* req);
 		static void sequentialShiftingHelper(
 				CorblivarDie* die_b1, CorblivarDie* die_b2,
 				CorblivarAlignmentReq const* req,
-				std::list<Block const*> b1_relev_blocks, std::list<Block const*> b2_relev_blocks,
+				std::vector<Block const*> const& b1_relev_blocks, std::vector<Block const*> const& b2_relev_blocks,
 				Direction const& dir_b1,
 				bool& b1_shifted, bool& b2_shifted);
-		std::vector<CorblivarAlignmentReq const*> findAlignmentReqs(Block const* b) const;
+		void findAlignmentReqs(Block const* b, std::vector<CorblivarAlignmentReq const*>& reqs) const;
 
 	// constructors, destructors, if any non-implicit
 	public:
@@ -95,10 +152,15 @@ class CorblivarCore {
 			for (int i = 0; i < layers; i++) {
 				CorblivarDie cur_die = CorblivarDie(i);
 				// reserve mem for worst case, i.e., all blocks in one particular die
-				cur_die.CBL.reserve(blocks);
+				cur_die.reserve(blocks);
 
 				this->dies.push_back(std::move(cur_die));
 			}
+
+			this->b1_relev_blocks.reserve(blocks);
+			this->b2_relev_blocks.reserve(blocks);
+
+			this->layout_hash = 0;
 		};
 
 	// public data, functions
@@ -122,117 +184,172 @@ class CorblivarCore {
 			return this->A;
 		};
 
+		// reserve mem for alignments-in-process list and related buffer; to be
+		// called once the alignment requests are set, such that layout
+		// generation does not allocate
+		inline void reserveAlignments() {
+			this->AL.reserve(this->A.size());
+			this->block_alignment_reqs.reserve(this->A.size());
+		};
+
+		// layout hashing; see layout_hash
+		inline unsigned long long const& getLayoutHash() const {
+			return this->layout_hash;
+		};
+		unsigned long long determLayoutHash() const;
+		inline void rehashLayout() {
+			this->layout_hash = this->determLayoutHash();
+		};
+		// toggle key of block's shape; to be called before and after shaping
+		inline void hashBlockShape(Block const* b) {
+			this->layout_hash ^= CorblivarCore::shapeKey(b);
+		};
+
 		// abstract layout-modification operations
 		//
+		// hashing helper; toggle keys of swapped tuples and their successors
+		inline void hashSwappedTuples(int const& die1, int const& die2, int const& tuple1, int const& tuple2) {
+
+			// overlapping neighborhoods have to be toggled only once
+			if (die1 == die2 && std::abs(tuple1 - tuple2) <= 1) {
+				this->hashTuples(die1, std::min(tuple1, tuple2), std::max(tuple1, tuple2) + 1);
+			}
+			else {
+				this->hashTuples(die1, tuple1, tuple1 + 1);
+				this->hashTuples(die2, tuple2, tuple2 + 1);
+			}
+		};
+
 		inline void swapBlocks(int const& die1, int const& die2, int const& tuple1, int const& tuple2) {
 
 			// pre-update layer assignments if swapping across dies
 			if (die1 != die2) {
-				this->dies[die1].CBL.S[tuple1]->layer = die2;
-				this->dies[die2].CBL.S[tuple2]->layer = die1;
+				this->dies[die1].CBL.tuples[tuple1].S->layer = die2;
+				this->dies[die2].CBL.tuples[tuple2].S->layer = die1;
 			}
 
-			// perform swap
-			std::swap(this->dies[die1].CBL.S[tuple1], this->dies[die2].CBL.S[tuple2]);
+			// perform swap; also update hash, where the successors of
+			// the swapped tuples are affected as well
+			this->hashSwappedTuples(die1, die2, tuple1, tuple2);
+			std::swap(this->dies[die1].CBL.tuples[tuple1].S, this->dies[die2].CBL.tuples[tuple2].S);
+			this->hashSwappedTuples(die1, die2, tuple1, tuple2);
+
+			// memorize modified tuples for incremental layout generation
+			this->dies[die1].markModified(tuple1);
+			this->dies[die2].markModified(tuple2);
 
 			if (DBG) {
 				std::cout << "DBG_CORE> swapBlocks;";
 				std::cout << " d1=" << die1;
-				std::cout << ", s1=" << this->dies[die1].CBL.S[tuple1]->id;
+				std::cout << ", s1=" << this->dies[die1].CBL.tuples[tuple1].S->id;
 				std::cout << ", d2=" << die2;
-				std::cout << ", s2=" << this->dies[die2].CBL.S[tuple2]->id;
+				std::cout << ", s2=" << this->dies[die2].CBL.tuples[tuple2].S->id;
 				std::cout << std::endl;
 			}
 		};
 
 		inline void moveTuples(int const& die1, int const& die2, int const& tuple1, int const& tuple2) {
-			Block const* t1_S;
-			Direction t1_L;
-			unsigned t1_T;
+
+			// memorize modified tuples for incremental layout generation;
+			// for moves within the same die, all tuples in between are
+			// shifted, which is covered by the lower tuple
+			this->dies[die1].markModified(tuple1);
+			this->dies[die2].markModified(tuple2);
 
 			if (DBG) {
 				std::cout << "DBG_CORE> moveTuples;";
 				std::cout << " d1=" << die1;
 				std::cout << ", t1=" << tuple1;
-				std::cout << " (s1=" << this->dies[die1].CBL.S[tuple1]->id << ")";
+				std::cout << " (s1=" << this->dies[die1].CBL.tuples[tuple1].S->id << ")";
 				std::cout << ", d2=" << die2;
 				std::cout << ", t2=" << tuple2;
-				std::cout << " (s2=" << this->dies[die2].CBL.S[tuple2]->id << ")";
+				std::cout << " (s2=" << this->dies[die2].CBL.tuples[tuple2].S->id << ")";
 				std::cout << std::endl;
 			}
 
 			// move within same die
 			if (die1 == die2) {
 
-				// temporary copy of source data; otherwise, if insert and
-				// readout are done at the same time, the wrong data may
-				// be read out since the offsets are already adapted for
-				// inserting the new element
-				t1_S = std::move(this->dies[die1].CBL.S[tuple1]);
-				t1_L = std::move(this->dies[die1].CBL.L[tuple1]);
-				t1_T = std::move(this->dies[die1].CBL.T[tuple1]);
+				// remove keys for hash; all tuples in between are
+				// shifted, but only the boundary tuples change their
+				// predecessors
+				this->hashTuples(die1, std::min(tuple1, tuple2), std::max(tuple1, tuple2) + 1);
 
-				// insert tuple1 from die1 into die1/die2 w/ offset tuple2
-				this->dies[die2].CBL.S.insert(this->dies[die2].CBL.S.begin() + tuple2, t1_S);
-				this->dies[die2].CBL.L.insert(this->dies[die2].CBL.L.begin() + tuple2, t1_L);
-				this->dies[die2].CBL.T.insert(this->dies[die2].CBL.T.begin() + tuple2, t1_T);
+				std::vector<CornerBlockList::Tuple>& tuples = this->dies[die1].CBL.tuples;
 
-				// erase tuple1 from die1
+				// move tuple1 to offset tuple2 by rotating the tuples in
+				// between; equivalent to inserting tuple1 at offset tuple2
+				// and erasing it from its former offset, but w/o
+				// reallocating/shifting the whole sequence twice
 				//
-				// adapt offset; in case tuple2 comes before tuple1, the
-				// offsets are all shifted by one after insertion
-				if (tuple1 > tuple2) {
-					this->dies[die1].CBL.S.erase(this->dies[die1].CBL.S.begin() + tuple1 + 1);
-					this->dies[die1].CBL.L.erase(this->dies[die1].CBL.L.begin() + tuple1 + 1);
-					this->dies[die1].CBL.T.erase(this->dies[die1].CBL.T.begin() + tuple1 + 1);
+				// in case tuple2 comes after tuple1, the tuple ends up
+				// before the previous tuple2, as for insertion before
+				// the erasure
+				if (tuple1 < tuple2) {
+					std::rotate(tuples.begin() + tuple1, tuples.begin() + tuple1 + 1, tuples.begin() + tuple2);
 				}
-				else {
-					this->dies[die1].CBL.S.erase(this->dies[die1].CBL.S.begin() + tuple1);
-					this->dies[die1].CBL.L.erase(this->dies[die1].CBL.L.begin() + tuple1);
-					this->dies[die1].CBL.T.erase(this->dies[die1].CBL.T.begin() + tuple1);
+				else if (tuple1 > tuple2) {
+					std::rotate(tuples.begin() + tuple2, tuples.begin() + tuple1, tuples.begin() + tuple1 + 1);
 				}
+
+				// add keys for hash
+				this->hashTuples(die1, std::min(tuple1, tuple2), std::max(tuple1, tuple2) + 1);
 			}
 			// move across dies
 			else {
+				// remove keys for hash; the removed tuple and its
+				// successor, and the tuple to become the successor of the
+				// inserted tuple
+				this->hashTuples(die1, tuple1, tuple1 + 1);
+				this->hashTuples(die2, tuple2, tuple2);
+
 				// pre-update layer assignment for block to be moved
-				this->dies[die1].CBL.S[tuple1]->layer = die2;
+				this->dies[die1].CBL.tuples[tuple1].S->layer = die2;
 
 				// insert tuple1 from die1 into die2 w/ offset tuple2
-				this->dies[die2].CBL.S.insert(this->dies[die2].CBL.S.begin() + tuple2, std::move(this->dies[die1].CBL.S[tuple1]));
-				this->dies[die2].CBL.L.insert(this->dies[die2].CBL.L.begin() + tuple2, std::move(this->dies[die1].CBL.L[tuple1]));
-				this->dies[die2].CBL.T.insert(this->dies[die2].CBL.T.begin() + tuple2, std::move(this->dies[die1].CBL.T[tuple1]));
+				this->dies[die2].CBL.tuples.insert(this->dies[die2].CBL.tuples.begin() + tuple2, this->dies[die1].CBL.tuples[tuple1]);
 
 				// erase tuple1 from die1
-				this->dies[die1].CBL.S.erase(this->dies[die1].CBL.S.begin() + tuple1);
-				this->dies[die1].CBL.L.erase(this->dies[die1].CBL.L.begin() + tuple1);
-				this->dies[die1].CBL.T.erase(this->dies[die1].CBL.T.begin() + tuple1);
+				this->dies[die1].CBL.tuples.erase(this->dies[die1].CBL.tuples.begin() + tuple1);
+
+				// add keys for hash; the former successor of the removed
+				// tuple, and the inserted tuple and its successor
+				this->hashTuples(die1, tuple1, tuple1);
+				this->hashTuples(die2, tuple2, tuple2 + 1);
 			}
 		};
 
 		inline void switchInsertionDirection(int const& die, int const& tuple) {
 
-			if (this->dies[die].CBL.L[tuple] == Direction::VERTICAL) {
-				this->dies[die].CBL.L[tuple] = Direction::HORIZONTAL;
+			// memorize modified tuple for incremental layout generation
+			this->dies[die].markModified(tuple);
+
+			this->hashTuples(die, tuple, tuple);
+			if (this->dies[die].CBL.tuples[tuple].L == Direction::VERTICAL) {
+				this->dies[die].CBL.tuples[tuple].L = Direction::HORIZONTAL;
 			}
 			else {
-				this->dies[die].CBL.L[tuple] = Direction::VERTICAL;
+				this->dies[die].CBL.tuples[tuple].L = Direction::VERTICAL;
 			}
+			this->hashTuples(die, tuple, tuple);
 
 			if (DBG) {
 				std::cout << "DBG_CORE> switchInsertionDirection;";
 				std::cout << " d1=" << die;
 				std::cout << ", t1=" << tuple;
-				std::cout << " (s1=" << this->dies[die].CBL.S[tuple]->id << ")";
+				std::cout << " (s1=" << this->dies[die].CBL.tuples[tuple].S->id << ")";
 				std::cout << std::endl;
 			}
 		};
 
 		inline void swapAlignmentCoordinates(int const& tuple) {
 
+			this->layout_hash ^= this->alignmentKey(tuple);
 			// swap alignment-request type
 			std::swap(this->A[tuple].type_x, this->A[tuple].type_y);
 			// also swap related offsets / ranges
 			std::swap(this->A[tuple].alignment_x, this->A[tuple].alignment_y);
+			this->layout_hash ^= this->alignmentKey(tuple);
 
 			if (DBG) {
 				std::cout << "DBG_CORE> swapAlignmentCoordinates;";
@@ -244,13 +361,18 @@ class CorblivarCore {
 
 		inline void switchTupleJunctions(int const& die, int const& tuple, int const& juncts) {
 
-			this->dies[die].CBL.T[tuple] = juncts;
+			this->hashTuples(die, tuple, tuple);
+			this->dies[die].CBL.tuples[tuple].T = juncts;
+			this->hashTuples(die, tuple, tuple);
+
+			// memorize modified tuple for incremental layout generation
+			this->dies[die].markModified(tuple);
 
 			if (DBG) {
 				std::cout << "DBG_CORE> switchTupleJunctions;";
 				std::cout << " d1=" << die;
 				std::cout << ", t1=" << tuple;
-				std::cout << " (s1=" << this->dies[die].CBL.S[tuple]->id << ")";
+				std::cout << " (s1=" << this->dies[die].CBL.tuples[tuple].S->id << ")";
 				std::cout << ", juncts=" << juncts;
 				std::cout << std::endl;
 			}
@@ -283,18 +405,12 @@ class CorblivarCore {
 				die.CBLbackup.clear();
 				die.CBLbackup.reserve(die.CBL.capacity());
 
-				for (Block const* b : die.CBL.S) {
+				die.CBLbackup.tuples = die.CBL.tuples;
 
-					// backup bb into block itself
-					b->bb_backup = b->bb;
+				for (CornerBlockList::Tuple const& tuple : die.CBLbackup.tuples) {
 
-					die.CBLbackup.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBL.L) {
-					die.CBLbackup.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBL.T) {
-					die.CBLbackup.T.push_back(t_juncts);
+					// backup bb into block itself
+					tuple.S->bb_backup = tuple.S->bb;
 				}
 			}
 		};
@@ -305,22 +421,21 @@ class CorblivarCore {
 				die.CBL.clear();
 				die.CBL.reserve(die.CBLbackup.capacity());
 
-				for (Block const* b : die.CBLbackup.S) {
+				die.CBL.tuples = die.CBLbackup.tuples;
+
+				for (CornerBlockList::Tuple const& tuple : die.CBL.tuples) {
 
 					// restore bb from block itself
-					b->bb = b->bb_backup;
+					tuple.S->bb = tuple.S->bb_backup;
 					// update layer assignment
-					b->layer = die.id;
-
-					die.CBL.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBLbackup.L) {
-					die.CBL.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBLbackup.T) {
-					die.CBL.T.push_back(t_juncts);
+					tuple.S->layer = die.id;
 				}
+
+				// restored CBL; invalidate checkpoints
+				die.invalidateCheckpoints();
 			}
+
+			this->rehashLayout();
 		};
 
 		// CBL best-solution handler
@@ -331,18 +446,12 @@ class CorblivarCore {
 				die.CBLbest.clear();
 				die.CBLbest.reserve(die.CBL.capacity());
 
-				for (Block const* b : die.CBL.S) {
+				die.CBLbest.tuples = die.CBL.tuples;
 
-					// backup bb into block itself
-					b->bb_best = b->bb;
+				for (CornerBlockList::Tuple const& tuple : die.CBLbest.tuples) {
 
-					die.CBLbest.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBL.L) {
-					die.CBLbest.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBL.T) {
-					die.CBLbest.T.push_back(t_juncts);
+					// backup bb into block itself
+					tuple.S->bb_best = tuple.S->bb;
 				}
 			}
 		};
@@ -357,36 +466,69 @@ class CorblivarCore {
 				die.CBL.clear();
 				die.CBL.reserve(die.CBLbest.capacity());
 
+				// restored CBL; invalidate checkpoints
+				die.invalidateCheckpoints();
+
 				if (die.CBLbest.empty()) {
 					empty_dies++;
 					continue;
 				}
 
-				for (Block const* b : die.CBLbest.S) {
+				die.CBL.tuples = die.CBLbest.tuples;
+
+				for (CornerBlockList::Tuple const& tuple : die.CBL.tuples) {
 
 					// restore bb from block itself
-					b->bb = b->bb_best;
+					tuple.S->bb = tuple.S->bb_best;
 					// update layer assignment
-					b->layer = die.id;
-
-					die.CBL.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBLbest.L) {
-					die.CBL.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBLbest.T) {
-					die.CBL.T.push_back(t_juncts);
+					tuple.S->layer = die.id;
 				}
 			}
 
 			ret = (empty_dies != this->dies.size());
 
+			this->rehashLayout();
+
 			if (!ret && log) {
 				std::cout << "Corblivar> No best (fitting) solution available!" << std::endl << std::endl;
 			}
 
 			return ret;
 		};
+
+		// CBL best-solution handler for SA replicas; adopt the best solution of
+		// another core whose CBLs refer to a different (replica) blocks container;
+		// blocks are rebound to the given own blocks container via their index
+		inline void adoptBestCBLs(CorblivarCore const& replica, std::vector<Block> const& replica_blocks, std::vector<Block> const& blocks) {
+			Block const* b_own;
+
+			for (CorblivarDie& die : this->dies) {
+
+				CorblivarDie const& die_replica = replica.dies[die.id];
+
+				die.CBLbest.clear();
+				die.CBLbest.reserve(die_replica.CBLbest.capacity());
+
+				for (CornerBlockList::Tuple const& tuple : die_replica.CBLbest.tuples) {
+
+					b_own = &blocks[tuple.S - replica_blocks.data()];
+
+					// adopt best bb into own block
+					b_own->bb_best = tuple.S->bb_best;
+
+					die.CBLbest.insert({b_own, tuple.L, tuple.T});
+				}
+			}
+
+			// alignment requests may have been altered during SA, see
+			// swapAlignmentCoordinates; adopt these changes as well
+			for (unsigned r = 0; r < this->A.size(); r++) {
+				this->A[r].type_x = replica.A[r].type_x;
+				this->A[r].type_y = replica.A[r].type_y;
+				this->A[r].alignment_x = replica.A[r].alignment_x;
+				this->A[r].alignment_y = replica.A[r].alignment_y;
+			}
+		};
 };
 
 #endif
@@ -27,9 +27,9 @@
 // required Corblivar headers
 #include "Math.hpp"
 #include "CorblivarAlignmentReq.hpp"
+#include "PhaseTimers.hpp"
 
 void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
-	std::list<Block const*> relevBlocks;
 
 	// current tuple; only mutable block parameters can be edited
 	Block const* cur_block = this->getCurrentBlock();
@@ -40,45 +40,78 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 		return;
 	}
 
+	// memorize checkpoint for incremental layout generation; only applicable
+	// w/o alignment, where previously placed blocks are never shifted
+	if (!alignment_enabled) {
+		this->checkpointStacks();
+	}
+
 	// pop relevant blocks from related placement stack
-	relevBlocks = this->popRelevantBlocks();
+	this->popRelevantBlocks(this->relev_blocks);
 
 	// horizontal placement
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
 		// first, determine block's y-coordinates
-		this->determCurrentBlockCoords(Coordinate::Y, relevBlocks);
+		this->determCurrentBlockCoords(Coordinate::Y, this->relev_blocks);
 		// second, determine block's x-coordinates (depends on y-coord; extended
 		// check depends on whether alignment is enabled, i.e., whether some
 		// blocks might be shifted)
-		this->determCurrentBlockCoords(Coordinate::X, relevBlocks, alignment_enabled);
+		this->determCurrentBlockCoords(Coordinate::X, this->relev_blocks, alignment_enabled);
 	}
 	// vertical placement
 	else {
 
 		// first, determine block's x-coordinates
-		this->determCurrentBlockCoords(Coordinate::X, relevBlocks);
+		this->determCurrentBlockCoords(Coordinate::X, this->relev_blocks);
 		// second, determine block's y-coordinates (depends on x-coord; extended
 		// check depends on whether alignment is enabled, i.e., whether some
 		// blocks might be shifted)
-		this->determCurrentBlockCoords(Coordinate::Y, relevBlocks, alignment_enabled);
+		this->determCurrentBlockCoords(Coordinate::Y, this->relev_blocks, alignment_enabled);
 	}
 
 	// update placement stacks
-	this->updatePlacementStacks(relevBlocks);
+	this->updatePlacementStacks(this->relev_blocks);
 
 	// mark block as placed
 	cur_block->placed = true;
 
+	// log placed block for incremental layout generation
+	if (!alignment_enabled) {
+		this->checkpointPlacedBlock();
+	}
+
 	// placement stacks debugging
 	if (CorblivarDie::DBG_STACKS) {
 		this->debugStacks();
 	}
 }
 
+void CorblivarDie::generateLayout() {
+
+	// reset die data; the layout generation can be resumed from the checkpoint
+	// nearest to the lowest modified tuple, since all previous tuples are placed
+	// just as before
+	this->resetToCheckpoint();
+
+	// sanity check for empty die
+	if (this->CBL.empty()) {
+		this->done = true;
+	}
+
+	// place blocks, increment progress pointer
+	while (!this->done) {
+		this->placeCurrentBlock(false);
+		this->updateProgressPointerFlag();
+	}
+
+	// the checkpoints are valid for the whole CBL now
+	this->markUnmodified();
+}
+
 void CorblivarDie::debugStacks() {
 	Block const* cur_block = this->getCurrentBlock();
-	std::list<Block const*>::iterator iter;
+	PlacementStack::const_iterator iter;
 
 	std::cout << "DBG_CORB> ";
 	std::cout << "Processed (placed) CBL tuple " << this->getCBL().tupleString(this->pi) << " on die " << this->id + 1 << ": ";
@@ -88,7 +121,7 @@ void CorblivarDie::debugStacks() {
 	std::cout << "DBG_CORB>  new stack Hi: ";
 	for (iter = this->Hi.begin(); iter != this->Hi.end(); ++iter) {
 
-		if (*iter != this->Hi.back()) {
+		if (std::next(iter) != this->Hi.end()) {
 			std::cout << (*iter)->id << ", ";
 		}
 		else {
@@ -100,7 +133,7 @@ void CorblivarDie::debugStacks() {
 	std::cout << "DBG_CORB>  new stack Vi: ";
 	for (iter = this->Vi.begin(); iter != this->Vi.end(); ++iter) {
 
-		if (*iter != this->Vi.back()) {
+		if (std::next(iter) != this->Vi.end()) {
 			std::cout << (*iter)->id << ", ";
 		}
 		else {
@@ -115,15 +148,18 @@ bool CorblivarDie::debugLayout() const {
 	bool flag_inner;
 
 	// check blocks against each other for (faulty) overlaps
-	for (Block const* a : this->getCBL().S) {
+	for (CornerBlockList::Tuple const& tuple_a : this->getCBL().getTuples()) {
 
+		Block const* a = tuple_a.S;
 		flag_inner = false;
 
-		for (Block const* b : this->getCBL().S) {
+		for (CornerBlockList::Tuple const& tuple_b : this->getCBL().getTuples()) {
+
+			Block const* b = tuple_b.S;
 
 			// ignore in outer loop checked blocks; start inner loop
 			// after current block is self-checked
-			if (a->id == b->id) {
+			if (a->numerical_id == b->numerical_id) {
 				flag_inner = true;
 				continue;
 			}
@@ -140,10 +176,12 @@ bool CorblivarDie::debugLayout() const {
 	return invalid;
 }
 
-std::list<Block const*> CorblivarDie::popRelevantBlocks() {
-	std::list<Block const*> ret;
+void CorblivarDie::popRelevantBlocks(std::vector<Block const*>& ret) {
 	unsigned blocks_count;
 
+	// reset buffer; retains reserved memory
+	ret.clear();
+
 	// horizontal placement; consider stack Hi
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
@@ -153,8 +191,8 @@ std::list<Block const*> CorblivarDie::popRelevantBlocks() {
 
 		// pop relevant blocks from stack into return list
 		while (blocks_count > ret.size()) {
-			ret.push_back(std::move(this->Hi.front()));
-			this->Hi.pop_front();
+			ret.push_back(this->Hi.top());
+			this->Hi.pop();
 		}
 	}
 	// vertical placement; consider stack Vi
@@ -166,15 +204,13 @@ std::list<Block const*> CorblivarDie::popRelevantBlocks() {
 
 		// pop relevant blocks from stack into return list
 		while (blocks_count > ret.size()) {
-			ret.push_back(std::move(this->Vi.front()));
-			this->Vi.pop_front();
+			ret.push_back(this->Vi.top());
+			this->Vi.pop();
 		}
 	}
-
-	return ret;
 }
 
-void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_stack) {
+void CorblivarDie::updatePlacementStacks(std::vector<Block const*> const& relev_blocks_stack) {
 	bool add_to_stack;
 	Block const* b;
 
@@ -188,7 +224,7 @@ void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_s
 
 		std::cout << "; relevant blocks: ";
 		for (Block const* b : relev_blocks_stack) {
-			if (b->id != relev_blocks_stack.back()->id) {
+			if (b->numerical_id != relev_blocks_stack.back()->numerical_id) {
 				std::cout << b->id << ", ";
 			}
 			else {
@@ -217,24 +253,24 @@ void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_s
 		}
 		// actual stack update
 		if (add_to_stack) {
-			this->Vi.push_front(cur_block);
+			this->Vi.push(cur_block);
 		}
 
 		// update horizontal stack
 		//
 		// always consider cur_block since it's one of the right-most blocks now
-		this->Hi.push_front(cur_block);
+		this->Hi.push(cur_block);
 		//
 		// add relevant blocks which have no block to the right, simplified by
 		// checking against cur_block (only block which can be right of others);
 		// by reverse iteration, we retain the (implicit) ordering of blocks
 		// popped from stack Hi regarding their insertion order; required for
 		// proper stack manipulation
-		for (std::list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (std::vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true)) {
-				this->Hi.push_front(b);
+				this->Hi.push(b);
 			}
 		}
 	}
@@ -256,32 +292,30 @@ void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_s
 		}
 		// actual stack update
 		if (add_to_stack) {
-			this->Hi.push_front(cur_block);
+			this->Hi.push(cur_block);
 		}
 
 		// update vertical stack
 		//
 		// always consider cur_block since it's one of the top-most blocks now
-		this->Vi.push_front(cur_block);
+		this->Vi.push(cur_block);
 		//
 		// add relevant blocks which have no block above, simplified by checking
 		// against cur_block (only block which can be above others); by reverse
 		// iteration, we retain the (implicit) ordering of blocks popped from
 		// stack Vi regarding their insertion order; required for proper stack
 		// manipulation
-		for (std::list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (std::vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_below_rectB(b->bb, cur_block->bb, true)) {
-				this->Vi.push_front(b);
+				this->Vi.push(b);
 			}
 		}
 	}
 }
 
-void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_stack) {
-	std::list<Block const*>::iterator iter;
-	std::list<Block const*> stack_backup;
+void CorblivarDie::rebuildPlacementStacks(std::vector<Block const*> const& relev_blocks_stack) {
 	bool covered;
 
 	// current block
@@ -294,7 +328,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 
 		std::cout << "; relevant blocks: ";
 		for (Block const* b : relev_blocks_stack) {
-			if (b->id != relev_blocks_stack.back()->id) {
+			if (b->numerical_id != relev_blocks_stack.back()->numerical_id) {
 				std::cout << b->id << ", ";
 			}
 			else {
@@ -316,25 +350,13 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 	// horizontal stack Hi
 	//
 	// a) check remaining blocks if they are covered now (by current block)
-	for (iter = this->Hi.begin(); iter != this->Hi.end();) {
-
-		covered = false;
-
-		// block is now covered
-		if (Rect::rectA_leftOf_rectB((*iter)->bb, cur_block->bb, true)) {
-
-			covered = true;
-
-			// drop block from stack; also update iter to point to next
-			// element
-			iter = this->Hi.erase(iter);
-		}
-
-		// regular iter update
-		if (!covered) {
-			++iter;
+	this->Hi.removeIf(
+		// lambda expression
+		[&](Block const* b) {
+			// block is now covered
+			return Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true);
 		}
-	}
+	);
 
 	// a) push back relevant blocks in case they are not covered (by current block);
 	// only for related insertion direction
@@ -342,7 +364,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 
 		for (Block const* b : relev_blocks_stack) {
 			if (!Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true)) {
-				this->Hi.push_front(b);
+				this->Hi.push(b);
 			}
 		}
 	}
@@ -365,7 +387,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 		}
 	}
 	if (!covered) {
-		this->Hi.push_back(cur_block);
+		this->Hi.pushBottom(cur_block);
 	}
 
 	// c) sort stack by y-dimension in descending order; retains the proper stack
@@ -381,25 +403,13 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 	// vertical stack Vi
 	//
 	// a) check remaining blocks if they are covered now (by current block)
-	for (iter = this->Vi.begin(); iter != this->Vi.end();) {
-
-		covered = false;
-
-		// block is now covered
-		if (Rect::rectA_below_rectB((*iter)->bb, cur_block->bb, true)) {
-
-			covered = true;
-
-			// drop block from stack; also update iter to point to next
-			// element
-			iter = this->Vi.erase(iter);
-		}
-
-		// regular iter update
-		if (!covered) {
-			++iter;
+	this->Vi.removeIf(
+		// lambda expression
+		[&](Block const* b) {
+			// block is now covered
+			return Rect::rectA_below_rectB(b->bb, cur_block->bb, true);
 		}
-	}
+	);
 
 	// a) push back relevant blocks in case they are not covered (by current block);
 	// only for related insertion direction
@@ -407,7 +417,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 
 		for (Block const* b : relev_blocks_stack) {
 			if (!Rect::rectA_below_rectB(b->bb, cur_block->bb, true)) {
-				this->Vi.push_front(b);
+				this->Vi.push(b);
 			}
 		}
 	}
@@ -430,7 +440,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 		}
 	}
 	if (!covered) {
-		this->Vi.push_back(cur_block);
+		this->Vi.pushBottom(cur_block);
 	}
 
 	// c) sort stack by x-dimension in descending order; retains the proper stack
@@ -446,21 +456,21 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 	// sanity check for different corner blocks; may result due to shifting of blocks;
 	// we need to try fixing both stacks since we cannot assume which is the correct
 	// corner block in this case
-	if (this->Hi.front() != this->Vi.front()) {
+	if (this->Hi.top() != this->Vi.top()) {
 
 		// first, try to fix Hi
 		//
-		// local copy Hi for backup
-		stack_backup = this->Hi;
+		// copy Hi for backup
+		this->stack_backup = this->Hi;
 
 		// try dropping blocks until corner blocks match
-		while (this->Hi.front() != this->Vi.front()) {
+		while (this->Hi.top() != this->Vi.top()) {
 
 			if (this->Hi.empty()) {
 				break;
 			}
 			else {
-				this->Hi.pop_front();
+				this->Hi.pop();
 			}
 		}
 
@@ -468,19 +478,19 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 		if (this->Hi.empty()) {
 
 			// restore Hi
-			this->Hi = stack_backup;
+			this->Hi = this->stack_backup;
 
-			// local copy Vi for backup
-			stack_backup = this->Vi;
+			// copy Vi for backup
+			this->stack_backup = this->Vi;
 
 			// try dropping blocks until corner blocks match
-			while (this->Hi.front() != this->Vi.front()) {
+			while (this->Hi.top() != this->Vi.top()) {
 
 				if (this->Vi.empty()) {
 					break;
 				}
 				else {
-					this->Vi.pop_front();
+					this->Vi.pop();
 				}
 			}
 
@@ -489,7 +499,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 			if (this->Vi.empty()) {
 
 				// restore Vi
-				this->Vi = stack_backup;
+				this->Vi = this->stack_backup;
 
 				// dbg log for failure
 				if (CorblivarDie::DBG_STACKS) {
@@ -500,7 +510,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 	}
 }
 
-void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, std::list<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
+void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, std::vector<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
 	double x, y;
 
 	// current block
@@ -689,7 +699,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 	shifted = false;
 
 	// first, determine reference block
-	if (shift_block->id == req->s_i->id) {
+	if (shift_block->numerical_id == req->s_i->numerical_id) {
 		reference_block = req->s_j;
 	}
 	else {
@@ -742,7 +752,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 			// walk all blocks (implicitly ordered such that placed blocks are first)
 			for (unsigned b = 0; b < this->getCBL().size(); b++) {
 
-				if (this->getBlock(b)->id == shift_block->id) {
+				if (this->getBlock(b)->numerical_id == shift_block->numerical_id) {
 					break;
 				}
 				else {
@@ -850,7 +860,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 			// walk all blocks (implicitly ordered such that placed blocks are first)
 			for (unsigned b = 0; b < this->getCBL().size(); b++) {
 
-				if (this->getBlock(b)->id == shift_block->id) {
+				if (this->getBlock(b)->numerical_id == shift_block->numerical_id) {
 					break;
 				}
 				else {
@@ -929,12 +939,16 @@ void CorblivarDie::performPacking(Direction const& dir) {
 	Block const* block;
 	Block const* neighbor;
 	double x, y;
-	std::vector<Rect> blocks_checked;
-	double range_checked;
-	Rect cur_intersect, cur_prev_intersect;
+	unsigned lo, hi;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::PERFORM_PACKING);
 
 	// store blocks in separate list, for subsequent sorting
-	blocks.insert(blocks.begin(), this->getCBL().S.begin(), this->getCBL().S.end());
+	blocks.reserve(this->getCBL().size());
+	for (CornerBlockList::Tuple const& tuple : this->getCBL().getTuples()) {
+		blocks.push_back(tuple.S);
+	}
 
 	if (dir == Direction::HORIZONTAL) {
 
@@ -944,90 +958,69 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			[&](Block const* b1, Block const* b2){
 				return (b1->bb.ll.x < b2->bb.ll.x)
 					// for blocks on same column, sort additionally by
-					// their width, putting the bigger back in the
-					// list, thus consider them first during
-					// subsequent checking for adjacent blocks
-					// (reverse list traversal)
+					// their width
 					|| (Math::doubleComp(b1->bb.ll.x, b2->bb.ll.x) && (b1->bb.ur.x < b2->bb.ur.x))
 					// for blocks on same column and w/ same width,
-					// order additionally by y-coordinate to ease list
-					// traversal (relevant blocks are adjacent tuples
-					// in list)
+					// order additionally by y-coordinate
 					|| (Math::doubleComp(b1->bb.ll.x, b2->bb.ll.x) && Math::doubleComp(b1->bb.ur.x, b2->bb.ur.x) && (b1->bb.ll.y < b2->bb.ll.y))
 					;
 			}
 		);
 
-		// for each block, check the adjacent blocks and perform packing by
-		// considering the neighbors' nearest right front
-		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
-			block= *i1;
-
-			// skip blocks at left boundary, they are implicitly packed
-			if (block->bb.ll.x == 0.0) {
-				continue;
-			}
-
-			// also skip blocks which are successfully aligned; this way, they
-			// keep their position and alignment is not broken
-			if (block->alignment == Block::AlignmentStatus::SUCCESS) {
-				continue;
-			}
+		// init right front of blocks, defined over y-dimension
+		this->packing_front.editCoords().clear();
+		for (Block const* b : blocks) {
+			this->packing_front.editCoords().push_back(b->bb.ll.y);
+			this->packing_front.editCoords().push_back(b->bb.ur.y);
+		}
+		this->packing_front.init();
 
-			// init packed coordinate
-			x = 0.0;
-			// init search stop flag
-			blocks_checked.clear();
-			range_checked = 0.0;
+		// sweep blocks from left to right; for each block, the right front of
+		// all previously swept blocks within the block's y-range provides the
+		// packed coordinate
+		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
+			block = *i1;
 
-			// check against other blocks; walk in reverse order since we only need to
-			// consider the blocks to the left
-			for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
-				neighbor = *i2;
+			lo = this->packing_front.index(block->bb.ll.y);
+			hi = this->packing_front.index(block->bb.ur.y);
 
-				if (Rect::rectA_leftOf_rectB(neighbor->bb, block->bb, true)) {
+			// skip blocks at left boundary, they are implicitly packed;
+			// also skip blocks which are successfully aligned; this way,
+			// they keep their position and alignment is not broken
+			if (block->bb.ll.x != 0.0 && block->alignment != Block::AlignmentStatus::SUCCESS) {
 
-					// determine the packed coordinate by considering
-					// the neigbors nearest right front
-					x = std::max(x, neighbor->bb.ur.x);
+				// determine the packed coordinate by considering the
+				// neighbors' nearest right front
+				x = this->packing_front.max(lo, hi);
 
-					// current blocks' intersection
-					cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
+				// the front can only be beyond the block's left edge in
+				// case the block is overlapping w/ some previous block,
+				// i.e., for invalid layouts; then, check against all
+				// previous blocks, considering only the blocks to the
+				// left
+				if (x > block->bb.ll.x) {
 
-					// initially, consider the full intersection range
-					// as relevant
-					range_checked += cur_intersect.h;
+					x = 0.0;
 
-					// check the intersection w/ previous
-					// intersections in order to avoid redundant
-					// considerations of ranges
-					for (Rect const& r : blocks_checked) {
+					for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
+						neighbor = *i2;
 
-						cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
-						// drop the additionally, redundant
-						// covered range
-						if (cur_prev_intersect.h > 0.0) {
-							range_checked -= cur_prev_intersect.h;
+						if (Rect::rectA_leftOf_rectB(neighbor->bb, block->bb, true)) {
+							x = std::max(x, neighbor->bb.ur.x);
 						}
 					}
-
-					// memorize the actually covered range of the
-					// block front; use a set of rectangles
-					blocks_checked.push_back(cur_intersect);
-
-					// in case the full block front was checked, we
-					// can stop checking other blocks
-					if (Math::doubleComp(block->bb.h, range_checked)) {
-						break;
-					}
 				}
+
+				// update coordinate on block itself, effects the final
+				// layout as well as the currently swept blocks (which is
+				// required for step-wise packing from left to right
+				// boundary)
+				block->bb.ll.x = x;
+				block->bb.ur.x = block->bb.w + x;
 			}
 
-			// update coordinate on block itself, effects the final layout as well as
-			// the currently walked list (which is required for step-wise packing from
-			// left to right boundary)
-			block->bb.ll.x = x;
-			block->bb.ur.x = block->bb.w + x;
+			// update right front w/ (packed) block
+			this->packing_front.raise(lo, hi, block->bb.ur.x);
 		}
 	}
 
@@ -1040,90 +1033,68 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			[&](Block const* b1, Block const* b2){
 				return (b1->bb.ll.y < b2->bb.ll.y)
 					// for blocks on same row, sort additionally by
-					// their height, putting the bigger back in the
-					// list, thus consider them first during
-					// subsequent checking for adjacent blocks
-					// (reverse list traversal)
+					// their height
 					|| (Math::doubleComp(b1->bb.ll.y, b2->bb.ll.y) && (b1->bb.ur.y < b2->bb.ur.y))
 					// for blocks on same row and w/ same height,
-					// order additionally by x-coordinate to ease list
-					// traversal (relevant blocks are adjacent tuples
-					// in list)
+					// order additionally by x-coordinate
 					|| (Math::doubleComp(b1->bb.ll.y, b2->bb.ll.y) && Math::doubleComp(b1->bb.ur.y, b2->bb.ur.y) && (b1->bb.ll.x < b2->bb.ll.x))
 					;
 			}
 		);
 
-		// for each block, check the adjacent blocks and perform packing by
-		// considering the neighbors' nearest upper front
-		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
-			block= *i1;
-
-			// skip blocks at bottom boundary, they are implicitly packed
-			if (block->bb.ll.y == 0.0) {
-				continue;
-			}
-
-			// also skip blocks which are successfully aligned; this way, they
-			// keep their position and alignment is not broken
-			if (block->alignment == Block::AlignmentStatus::SUCCESS) {
-				continue;
-			}
+		// init upper front of blocks, defined over x-dimension
+		this->packing_front.editCoords().clear();
+		for (Block const* b : blocks) {
+			this->packing_front.editCoords().push_back(b->bb.ll.x);
+			this->packing_front.editCoords().push_back(b->bb.ur.x);
+		}
+		this->packing_front.init();
 
-			// init packed coordinate
-			y = 0.0;
-			// init search stop flag
-			blocks_checked.clear();
-			range_checked = 0.0;
+		// sweep blocks from bottom to top; for each block, the upper front of
+		// all previously swept blocks within the block's x-range provides the
+		// packed coordinate
+		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
+			block = *i1;
 
-			// check against other blocks; walk in reverse order since we only need to
-			// consider the blocks below
-			for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
-				neighbor = *i2;
+			lo = this->packing_front.index(block->bb.ll.x);
+			hi = this->packing_front.index(block->bb.ur.x);
 
-				if (Rect::rectA_below_rectB(neighbor->bb, block->bb, true)) {
+			// skip blocks at bottom boundary, they are implicitly packed;
+			// also skip blocks which are successfully aligned; this way,
+			// they keep their position and alignment is not broken
+			if (block->bb.ll.y != 0.0 && block->alignment != Block::AlignmentStatus::SUCCESS) {
 
-					// determine the packed coordinate by considering
-					// the neigbors nearest right front
-					y = std::max(y, neighbor->bb.ur.y);
+				// determine the packed coordinate by considering the
+				// neighbors' nearest upper front
+				y = this->packing_front.max(lo, hi);
 
-					// current blocks' intersection
-					cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
+				// the front can only be beyond the block's bottom edge in
+				// case the block is overlapping w/ some previous block,
+				// i.e., for invalid layouts; then, check against all
+				// previous blocks, considering only the blocks below
+				if (y > block->bb.ll.y) {
 
-					// initially, consider the full intersection range
-					// as relevant
-					range_checked += cur_intersect.w;
+					y = 0.0;
 
-					// check the intersection w/ previous
-					// intersections in order to avoid redundant
-					// considerations of ranges
-					for (Rect const& r : blocks_checked) {
+					for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
+						neighbor = *i2;
 
-						cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
-						// drop the additionally, redundant
-						// covered range
-						if (cur_prev_intersect.w > 0.0) {
-							range_checked -= cur_prev_intersect.w;
+						if (Rect::rectA_below_rectB(neighbor->bb, block->bb, true)) {
+							y = std::max(y, neighbor->bb.ur.y);
 						}
 					}
-
-					// memorize the actually covered range of the
-					// block front; use a set of rectangles
-					blocks_checked.push_back(cur_intersect);
-
-					// in case the full block front was checked, we
-					// can stop checking other blocks
-					if (Math::doubleComp(block->bb.w, range_checked)) {
-						break;
-					}
 				}
+
+				// update coordinate on block itself, effects the final
+				// layout as well as the currently swept blocks (which is
+				// required for step-wise packing from bottom to top
+				// boundary)
+				block->bb.ll.y = y;
+				block->bb.ur.y = block->bb.h + y;
 			}
 
-			// update coordinate on block itself, effects the final layout as
-			// well as the currently walked list (which is required for
-			// step-wise packing from bottom to top boundary)
-			block->bb.ll.y = y;
-			block->bb.ur.y = block->bb.h + y;
+			// update upper front w/ (packed) block
+			this->packing_front.raise(lo, hi, block->bb.ur.y);
 		}
 	}
 }
@@ -30,6 +30,8 @@
 #include "CornerBlockList.hpp"
 #include "CorblivarAlignmentReq.hpp"
 #include "Coordinate.hpp"
+#include "PlacementStack.hpp"
+#include "PackingFront.hpp"
 // forward declarations, if any
 class Block;
 
@@ -48,8 +50,14 @@ class CorblivarDie {
 		// progress pointer, CBL vector index
 		unsigned pi;
 
-		// placement stacks; for efficiency implemented as list
-		std::list<Block const*> Hi, Vi;
+		// placement stacks; for efficiency implemented as contiguous,
+		// pre-reserved stacks
+		PlacementStack Hi, Vi;
+
+		// buffers for relevant blocks popped from stacks and for stack backups;
+		// pre-reserved as well, such that layout generation does not allocate
+		std::vector<Block const*> relev_blocks;
+		PlacementStack stack_backup;
 
 		// main CBL sequence
 		CornerBlockList CBL;
@@ -57,6 +65,41 @@ class CorblivarDie {
 		// backup CBL sequences
 		CornerBlockList CBLbackup, CBLbest;
 
+		// checkpoints for incremental layout generation; the placement stacks
+		// are memorized before each CHECKPOINT_INTERVAL-th tuple is placed, and
+		// the resulting (non-packed) bb of each placed block is logged; layout
+		// generation w/o alignment can then resume from the checkpoint nearest
+		// to the lowest modified tuple since tuples before are not affected
+		static constexpr unsigned CHECKPOINT_INTERVAL = 8;
+		struct Checkpoint {
+			PlacementStack Hi, Vi;
+		};
+		std::vector<Checkpoint> checkpoints;
+		unsigned checkpoints_count;
+		std::vector<Rect> placed_bbs;
+
+		// lowest tuple modified since previous layout generation
+		unsigned modified_tuple;
+
+		// front of packed blocks, for sweep-line packing
+		PackingFront packing_front;
+
+		// checkpoint handler; memorize stacks and log placed block
+		inline void checkpointStacks() {
+
+			if (this->pi % CorblivarDie::CHECKPOINT_INTERVAL == 0) {
+
+				// assignment reuses the memory reserved for the
+				// checkpoint, see reserve()
+				this->checkpoints[this->checkpoints_count].Hi = this->Hi;
+				this->checkpoints[this->checkpoints_count].Vi = this->Vi;
+				this->checkpoints_count++;
+			}
+		};
+		inline void checkpointPlacedBlock() {
+			this->placed_bbs.push_back(this->getCurrentBlock()->bb);
+		};
+
 		// reset handler
 		inline void reset() {
 
@@ -71,8 +114,55 @@ class CorblivarDie {
 			this->Vi.clear();
 
 			// reset placed flags
-			for (Block const* b : this->CBL.S) {
-				b->placed = false;
+			for (CornerBlockList::Tuple const& tuple : this->CBL.tuples) {
+				tuple.S->placed = false;
+			}
+		};
+
+		// reset handler for incremental layout generation; restore state of the
+		// checkpoint nearest to the lowest modified tuple, falls back to regular
+		// reset if no such checkpoint is available
+		inline void resetToCheckpoint() {
+			unsigned checkpoint;
+
+			if (this->checkpoints_count == 0 || this->CBL.empty()) {
+				this->reset();
+				this->placed_bbs.clear();
+				return;
+			}
+
+			// note that the CBL may have shrunk in the meantime, i.e., the
+			// checkpointed tuple must still be a valid tuple
+			checkpoint = std::min(this->modified_tuple, static_cast<unsigned>(this->CBL.size()) - 1) / CorblivarDie::CHECKPOINT_INTERVAL;
+			checkpoint = std::min(checkpoint, this->checkpoints_count - 1);
+
+			// reset progress pointer to checkpointed tuple
+			this->pi = checkpoint * CorblivarDie::CHECKPOINT_INTERVAL;
+
+			// reset done flag
+			this->done = false;
+
+			// restore placement stacks
+			this->Hi = this->checkpoints[checkpoint].Hi;
+			this->Vi = this->checkpoints[checkpoint].Vi;
+
+			// drop this and all later checkpoints; they are memorized again
+			// during layout generation
+			this->checkpoints_count = checkpoint;
+			this->placed_bbs.resize(this->pi);
+
+			// restore bbs of blocks placed before checkpointed tuple; required
+			// since they may have been packed in the meantime; reset placed
+			// flags for other blocks
+			for (unsigned t = 0; t < this->CBL.size(); t++) {
+
+				if (t < this->pi) {
+					this->CBL.tuples[t].S->bb = this->placed_bbs[t];
+					this->CBL.tuples[t].S->placed = true;
+				}
+				else {
+					this->CBL.tuples[t].S->placed = false;
+				}
 			}
 		};
 
@@ -92,14 +182,14 @@ class CorblivarDie {
 		bool shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq const* req, bool const& dry_run = false);
 
 		// layout-generation helper: determine coordinates of block in process
-		void determCurrentBlockCoords(Coordinate const& coord, std::list<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
+		void determCurrentBlockCoords(Coordinate const& coord, std::vector<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
 		// layout-generation helper: pop relevant blocks to consider during
-		// placement from stacks
-		std::list<Block const*> popRelevantBlocks();
+		// placement from stacks into given buffer
+		void popRelevantBlocks(std::vector<Block const*>& relev_blocks_stack);
 		// layout-generation helper: update placement stack (after placement)
-		void updatePlacementStacks(std::list<Block const*>& relev_blocks_stack);
+		void updatePlacementStacks(std::vector<Block const*> const& relev_blocks_stack);
 		// layout-generation helper: rebuild placement stack (after block shifting)
-		void rebuildPlacementStacks(std::list<Block const*>& relev_blocks_stack);
+		void rebuildPlacementStacks(std::vector<Block const*> const& relev_blocks_stack);
 		// layout-generation helper: placement stacks debugging
 		void debugStacks();
 
@@ -109,42 +199,77 @@ class CorblivarDie {
 			this->stalled = false;
 			this->done = false;
 			this->id = id;
+			this->checkpoints_count = 0;
+			this->modified_tuple = 0;
 		}
 
+		// reserve mem for worst case, i.e., all blocks in this die
+		inline void reserve(unsigned const& blocks) {
+
+			this->CBL.reserve(blocks);
+
+			this->Hi.reserve(blocks);
+			this->Vi.reserve(blocks);
+			this->relev_blocks.reserve(blocks);
+			this->stack_backup.reserve(blocks);
+
+			this->placed_bbs.reserve(blocks);
+
+			// init all checkpoints; the stacks memorized before the
+			// k-th checkpointed tuple hold at most the k *
+			// CHECKPOINT_INTERVAL blocks placed so far
+			this->checkpoints.resize(blocks / CorblivarDie::CHECKPOINT_INTERVAL + 1);
+			for (unsigned c = 0; c < this->checkpoints.size(); c++) {
+				this->checkpoints[c].Hi.reserve(c * CorblivarDie::CHECKPOINT_INTERVAL);
+				this->checkpoints[c].Vi.reserve(c * CorblivarDie::CHECKPOINT_INTERVAL);
+			}
+		};
+
 	// public data, functions
 	public:
 		friend class CorblivarCore;
 
-		// setter
+		// setter; CBL may be edited arbitrarily, thus invalidate checkpoints
 		inline CornerBlockList& editCBL() {
+			this->invalidateCheckpoints();
 			return this->CBL;
 		};
 
+		// checkpoint handlers; to be called for any modification of the CBL or
+		// of the shape of blocks
+		inline void markModified(unsigned const& tuple) {
+			this->modified_tuple = std::min(this->modified_tuple, tuple);
+		};
+		inline void invalidateCheckpoints() {
+			this->modified_tuple = 0;
+			this->checkpoints_count = 0;
+		};
+		inline void markUnmodified() {
+			this->modified_tuple = this->CBL.size();
+		};
+
 		// getter
 		inline CornerBlockList const& getCBL() const {
 			return this->CBL;
 		};
-		inline std::vector<Block const*> const& getBlocks() const {
-			return this->CBL.S;
-		};
 		inline Block const* getBlock(unsigned const& tuple) const {
-			return this->CBL.S[tuple];
+			return this->CBL.tuples[tuple].S;
 		};
 		inline Block const* getCurrentBlock() const {
-			return this->CBL.S[this->pi];
+			return this->CBL.tuples[this->pi].S;
 		};
 		inline Direction const& getCurrentDirection() const {
-			return this->CBL.L[this->pi];
+			return this->CBL.tuples[this->pi].L;
 		};
 		inline unsigned const& getJunctions(unsigned const& tuple) const {
-			return this->CBL.T[tuple];
+			return this->CBL.tuples[tuple].T;
 		};
 		inline int getTuple(Block const* block) const {
 			unsigned index;
 
-			for (index = 0; index < this->CBL.S.size(); index++) {
+			for (index = 0; index < this->CBL.size(); index++) {
 
-				if (block->id == this->CBL.S[index]->id) {
+				if (block->numerical_id == this->CBL.tuples[index].S->numerical_id) {
 					return index;
 				}
 			}
@@ -152,6 +277,10 @@ class CorblivarDie {
 			return -1;
 		};
 
+		// layout generation w/o alignment; place all blocks of this die, resumed
+		// from the nearest checkpoint
+		void generateLayout();
+
 		// layout generation: packing, to be performed as post-placement operation
 		void performPacking(Direction const& dir);
 
@@ -35,16 +35,6 @@ class CornerBlockList {
 	private:
 		static constexpr bool DBG = false;
 
-	// private data, functions
-	private:
-		// CBL sequences
-		std::vector<Block const*> S;
-		std::vector<Direction> L;
-		std::vector<unsigned> T;
-
-	// constructors, destructors, if any non-implicit
-	public:
-
 	// public data, functions
 	public:
 		friend class CorblivarCore;
@@ -57,63 +47,52 @@ class CornerBlockList {
 			unsigned T;
 		};
 
-		// getter / setter
-		inline unsigned size() const {
+	// private data, functions
+	private:
+		// CBL sequences S, L, T; stored interleaved as tuples, thus editing of
+		// tuples moves all their data at once
+		std::vector<Tuple> tuples;
 
-			if (DBG) {
-				unsigned ret;
-				bool mismatch = false;
-				unsigned prev_ret;
-
-				prev_ret = ret = this->S.size();
-				ret = std::min<unsigned>(ret, this->L.size());
-				mismatch = (ret != prev_ret);
-				prev_ret = ret;
-				ret = std::min<unsigned>(ret, this->T.size());
-				mismatch = mismatch || (ret != prev_ret);
-
-				if (mismatch) {
-					std::cout << "DBG_CBL> CBL has sequences size mismatch!" << std::endl;
-					std::cout << "DBG_CBL> CBL: " << std::endl;
-					std::cout << this->CBLString() << std::endl;
-				}
-			}
+	// constructors, destructors, if any non-implicit
+	public:
 
-			return this->S.size();
+	// public data, functions
+	public:
+		// getter / setter
+		inline unsigned size() const {
+			return this->tuples.size();
 		};
 
 		inline unsigned capacity() const {
-			return this->S.capacity();
+			return this->tuples.capacity();
 		};
 
 		inline bool empty() const {
-			return this->S.empty();
+			return this->tuples.empty();
 		};
 
 		inline void clear() {
-			this->S.clear();
-			this->L.clear();
-			this->T.clear();
+			this->tuples.clear();
 		};
 
 		inline void reserve(unsigned const& elements) {
-			this->S.reserve(elements);
-			this->L.reserve(elements);
-			this->T.reserve(elements);
+			this->tuples.reserve(elements);
 		};
 
 		inline void insert(Tuple&& tuple) {
-			this->S.push_back(tuple.S);
-			this->L.push_back(tuple.L);
-			this->T.push_back(tuple.T);
+			this->tuples.push_back(std::move(tuple));
+		};
+
+		inline std::vector<Tuple> const& getTuples() const {
+			return this->tuples;
 		};
 
 		inline std::string tupleString(unsigned const& tuple) const {
 			std::stringstream ret;
 
 			ret << "tuple " << tuple << " : ";
-			ret << "( " << this->S[tuple]->id << " " << static_cast<unsigned>(this->L[tuple]) << " " << this->T[tuple] << " ";
-			ret << this->S[tuple]->bb.w << " " << this->S[tuple]->bb.h << " )";
+			ret << "( " << this->tuples[tuple].S->id << " " << static_cast<unsigned>(this->tuples[tuple].L) << " " << this->tuples[tuple].T << " ";
+			ret << this->tuples[tuple].S->bb.w << " " << this->tuples[tuple].S->bb.h << " )";
 
 			return ret.str();
 		};
@@ -31,28 +31,18 @@
 #include "Net.hpp"
 #include "IO.hpp"
 #include "Clustering.hpp"
+#include "ThreadPool.hpp"
+#include "PhaseTimers.hpp"
 
 // main handler
 bool FloorPlanner::performSA(CorblivarCore& corb) {
-	int i, ii;
+	int i;
 	int innerLoopMax;
-	int accepted_ops;
 	double accepted_ops_ratio;
-	bool op_success;
-	double cur_cost, best_cost, prev_cost, cost_diff, avg_cost, fitting_cost;
-	Cost cost, cost_sanity_check;
 	std::vector<double> cost_samples;
-	double cur_temp, init_temp;
-	double r;
-	int layout_fit_counter;
-	double fitting_layouts_ratio;
-	bool valid_layout_found;
-	int i_valid_layout_found;
-	bool best_sol_found;
-	bool accept;
-	bool SA_phase_two, SA_phase_two_init;
-	bool valid_layout;
-	TempPhase cooling_phase;
+	double init_temp;
+	SAChain chain;
+	std::chrono::steady_clock::time_point step_start;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::performSA(" << &corb << ")" << std::endl;
@@ -75,14 +65,7 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	//
 	// init loop parameters
 	i = 1;
-	cur_temp = init_temp;
-	cooling_phase = TempPhase::PHASE_1;
-	SA_phase_two = SA_phase_two_init = false;
-	valid_layout_found = false;
-	i_valid_layout_found = Point::UNDEF;
-	fitting_layouts_ratio = 0.0;
-	// dummy large value to accept first fitting solution
-	best_cost = 100.0 * Math::stdDev(cost_samples);
+	this->initSAChain(chain, init_temp, cost_samples);
 
 	/// outer loop: annealing -- temperature steps
 	while (i <= this->schedule.loop_limit) {
@@ -91,32 +74,171 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 			std::cout << "SA> Optimization step: " << i << "/" << this->schedule.loop_limit << std::endl;
 		}
 
-		// init loop parameters
-		ii = 1;
-		avg_cost = 0.0;
-		accepted_ops = 0;
-		layout_fit_counter = 0;
-		SA_phase_two_init = false;
-		best_sol_found = false;
+		// inner loop: layout operations
+		step_start = std::chrono::steady_clock::now();
+		this->performSAStep(corb, chain, innerLoopMax, i);
 
-		// init cost for current layout and fitting ratio
-		this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
-		cur_cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two).total_cost;
+		// determine accepted-ops ratio
+		accepted_ops_ratio = static_cast<double>(chain.accepted_ops) / chain.ops;
 
-		// inner loop: layout operations
-		while (ii <= innerLoopMax) {
+		if (this->logMax()) {
+			std::cout << "SA> Step done:" << std::endl;
+			std::cout << "SA>  new best solution found: " << chain.best_sol_found << std::endl;
+			std::cout << "SA>  accept-ops ratio: " << accepted_ops_ratio << std::endl;
+			std::cout << "SA>  valid-layouts ratio: " << chain.fitting_layouts_ratio << std::endl;
+			std::cout << "SA>  avg cost: " << chain.avg_cost << std::endl;
+			std::cout << "SA>  temp: " << chain.cur_temp << std::endl;
+		}
+
+		// monitor power-blurring estimates w/ steady-state thermal solver; the
+		// thermal analysis and the blocks relate to the last evaluated layout
+		if (this->logMed() && chain.SA_phase_two && this->opt_flags.thermal &&
+				this->thermal_solver_parameters.SA_steps_interval > 0 && i % this->thermal_solver_parameters.SA_steps_interval == 0) {
+
+			this->evaluateSteadyStateTemp();
+
+			std::cout << "SA> Step " << i << "; max temp for lowest layer [K]: " << this->thermal_solver_result.max_temp;
+			std::cout << " (thermal solver), " << this->thermal_analysis.max_temp << " (power blurring)" << std::endl;
+		}
+
+		// log temperature step
+		TempStep cur_step;
+		cur_step.step = i;
+		cur_step.temp = chain.cur_temp;
+		cur_step.avg_cost = chain.avg_cost;
+		cur_step.new_best_sol_found = chain.best_sol_found;
+		cur_step.cost_best_sol = chain.best_cost;
+		this->tempSchedule.push_back(std::move(cur_step));
+
+		// stream telemetry for temperature step
+		if (this->telemetry) {
+			this->streamTelemetry(i, chain, chain.best_cost, chain.best_sol_found,
+					chain.ops / std::chrono::duration<double>(std::chrono::steady_clock::now() - step_start).count());
+		}
+
+		// update SA temperature
+		chain.cooling_phase = this->updateTemp(chain.cur_temp, i, chain.i_valid_layout_found);
+
+		// consider next outer step
+		i++;
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Done" << std::endl;
+		std::cout << std::endl;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::performSA : " << chain.valid_layout_found << std::endl;
+	}
+
+	return chain.valid_layout_found;
+}
+
+void FloorPlanner::initSAChain(SAChain& chain, double const& init_temp, std::vector<double> const& cost_samples) const {
+
+	chain.cur_temp = init_temp;
+	chain.cooling_phase = TempPhase::PHASE_1;
+	chain.SA_phase_two = false;
+	chain.valid_layout_found = false;
+	chain.i_valid_layout_found = Point::UNDEF;
+	chain.fitting_layouts_ratio = 0.0;
+	// dummy large value to accept first fitting solution
+	chain.best_cost = 100.0 * Math::stdDev(cost_samples);
+}
+
+// SA temperature step, i.e., inner loop of layout operations at current temperature
+void FloorPlanner::performSAStep(CorblivarCore& corb, SAChain& chain, int const& innerLoopMax, int const& iteration) {
+	int ii;
+	bool op_success;
+	double cur_cost, prev_cost, cost_diff, fitting_cost;
+	bool fitting_cost_avail;
+	Cost cost, cost_sanity_check;
+	double r, cost_ceiling;
+	unsigned long long cache_key;
+	bool cached;
+	double cached_time;
+	PhaseTimers::Clock::time_point evaluation_start;
+	bool accept;
+	bool SA_phase_two_init;
+	bool valid_layout;
+	PhaseTimers::SAPhase SA_phase;
+	PhaseTimers::Clock::time_point SA_phase_start;
+	unsigned long evaluated_ops;
+
+	// profiling; track evaluated layout ops per SA phase; note that a transition
+	// of phases ends the step, i.e., the phase at the begin applies to all ops
+	SA_phase = chain.SA_phase_two ? PhaseTimers::SA_PHASE_TWO : PhaseTimers::SA_PHASE_ONE;
+	SA_phase_start = PhaseTimers::now();
+	evaluated_ops = 0;
+
+	// init loop parameters
+	ii = 1;
+	chain.avg_cost = 0.0;
+	chain.accepted_ops = 0;
+	chain.layout_fit_counter = 0;
+	SA_phase_two_init = false;
+	chain.best_sol_found = false;
+
+	// init cost for current layout and fitting ratio
+	this->generateLayout(corb, this->opt_flags.alignment && chain.SA_phase_two);
+	chain.accepted_cost = this->evaluateLayout(corb.getAlignments(), chain.fitting_layouts_ratio, chain.SA_phase_two);
+	cur_cost = chain.accepted_cost.total_cost;
 
-			// perform layout op
-			op_success = layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, false, (cooling_phase == TempPhase::PHASE_3));
+	// inner loop: layout operations
+	while (ii <= innerLoopMax) {
 
-			if (op_success) {
+		// perform layout op
+		op_success = layoutOp.performLayoutOp(corb, chain.layout_fit_counter, chain.SA_phase_two, false, (chain.cooling_phase == TempPhase::PHASE_3));
 
-				prev_cost = cur_cost;
+		if (op_success) {
+
+			evaluated_ops++;
+			prev_cost = cur_cost;
+
+			// Metropolis criterion, w/ the random number drawn before the
+			// evaluation: a solution w/ worse or same cost is to be accepted if
+			// r <= exp(- cost_diff / temp), i.e., if the cost doesn't exceed the
+			// ceiling prev_cost - temp * ln(r); solutions w/ better cost always
+			// stay below this ceiling
+			r = Math::randF(0, 1);
+			cost_ceiling = prev_cost - chain.cur_temp * std::log(r);
+
+			// dbg incrementally maintained layout hash
+			if (FloorPlanner::DBG_EVALUATION_CACHE && corb.getLayoutHash() != corb.determLayoutHash()) {
+				std::cout << "DBG_EVALUATION_CACHE> Layout hash mismatch after layout op" << std::endl;
+			}
+
+			// consult cache of layout evaluations; the evaluation context
+			// is the SA phase and the fitting ratio, which both impact the
+			// cost function; a cached lower bound of the cost is only
+			// conclusive if it exceeds the current ceiling as well
+			//
+			// w/ clustering of signal TSVs or w/ thermal optimization, the
+			// cost in SA phase two also depends on the thermal map and the
+			// incremental thermal-analysis state of previous evaluations;
+			// they are identified by the count of thermal analyses, which is
+			// thus covered by the key as well
+			cache_key = corb.getLayoutHash() ^ Math::hash64(Math::doubleBits(chain.fitting_layouts_ratio) ^ chain.SA_phase_two);
+			if (chain.SA_phase_two && (this->layoutOp.parameters.signal_TSV_clustering || this->opt_flags.thermal)) {
+				cache_key ^= Math::hash64(~this->thermal_analyses);
+			}
+			cached = this->lookupEvaluationCache(cache_key, cost) && (!cost.exceeds_ceiling || cost.total_cost > cost_ceiling);
+			cached_time = cached ? this->evaluation_cache.entries.front().time : 0.0;
+
+			if (cached) {
+				// the layout is neither generated nor evaluated; thus, the
+				// cache of interconnects still relates to the previous
+				// evaluation and must not be rolled back
+				this->commitInterconnectsCache();
+			}
+			else {
+				evaluation_start = PhaseTimers::now();
 
 				// generate layout; also memorize whether layout is valid;
 				// note that this return value is only effective if
 				// FloorPlanner::DBG_LAYOUT is set
-				valid_layout = this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
+				valid_layout = this->generateLayout(corb, this->opt_flags.alignment && chain.SA_phase_two);
 
 				// dbg invalid layouts
 				if (FloorPlanner::DBG_LAYOUT && !valid_layout) {
@@ -132,195 +254,716 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 					exit(1);
 				}
 
-				// evaluate layout, new cost
-				cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two);
-				cur_cost = cost.total_cost;
-				// cost difference
-				cost_diff = cur_cost - prev_cost;
+				// evaluate layout, new cost; the evaluation is aborted once the
+				// layout is known to exceed the ceiling
+				cost = this->evaluateLayout(corb.getAlignments(), chain.fitting_layouts_ratio, chain.SA_phase_two, false, false, cost_ceiling);
+
+				this->insertEvaluationCache(cache_key, cost, PhaseTimers::elapsed(evaluation_start));
+			}
+
+			cur_cost = cost.total_cost;
+			// cost difference; for aborted evaluations, this is a lower bound
+			cost_diff = cur_cost - prev_cost;
+
+			if (FloorPlanner::DBG_SA) {
+				std::cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopMax << std::endl;
+				std::cout << "DBG_SA> Cost diff: " << cost_diff << std::endl;
+			}
+
+			// revert solution exceeding the ceiling
+			accept = true;
+			if (cost.exceeds_ceiling || cur_cost > cost_ceiling) {
 
 				if (FloorPlanner::DBG_SA) {
-					std::cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopMax << std::endl;
-					std::cout << "DBG_SA> Cost diff: " << cost_diff << std::endl;
+					std::cout << "DBG_SA> Revert op" << std::endl;
 				}
+				accept = false;
 
-				// revert solution w/ worse or same cost, depending on temperature
-				accept = true;
-				if (cost_diff >= 0.0) {
-					r = Math::randF(0, 1);
-					if (r > exp(- cost_diff / cur_temp)) {
+				// revert last op
+				layoutOp.performLayoutOp(corb, chain.layout_fit_counter, chain.SA_phase_two, true);
+				// also revert cached interconnects
+				this->rollbackInterconnectsCache();
+				// reset cost according to reverted CBL
+				cur_cost = prev_cost;
+			}
+			// accepted solution from cache; generate and evaluate the layout,
+			// such that the blocks' geometry and all derived state, i.e., TSVs,
+			// alignment flags and thermal maps, relate to the CBLs again, as
+			// required for subsequent ops and for memorizing the best solution
+			else if (cached) {
+				this->generateLayout(corb, this->opt_flags.alignment && chain.SA_phase_two);
+				cost = this->evaluateLayout(corb.getAlignments(), chain.fitting_layouts_ratio, chain.SA_phase_two);
+				cur_cost = cost.total_cost;
 
-						if (FloorPlanner::DBG_SA) {
-							std::cout << "DBG_SA> Revert op" << std::endl;
-						}
-						accept = false;
+				// no time saved by this cache hit
+				cached_time = 0.0;
+			}
 
-						// revert last op
-						layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, true);
-						// reset cost according to reverted CBL
-						cur_cost = prev_cost;
-					}
-				}
+			// profiling
+			PhaseTimers::recordCacheLookup(SA_phase, cached, cached_time);
 
-				// solution to be accepted, i.e., previously not reverted
-				if (accept) {
-					// update ops count
-					accepted_ops++;
-					// sum up cost for subsequent avg determination
-					avg_cost += cur_cost;
-
-					// consider solution to be accepted only if it
-					// actually fits the fixed outline
-					if (cost.fits_fixed_outline) {
-
-						// consider to switch to SA phase two when
-						// first fitting solution is found
-						if (!SA_phase_two) {
-
-							// however, cases w/ alignment
-							// require another check
-							if (this->opt_flags.alignment) {
-
-								// first, we need to re-determine
-								// the layout w/ enforced
-								// alignment which has not
-								// happened previously
-								this->generateLayout(corb, true);
-
-								// re-determine if layout still
-								// fits, after applying alignment
-								// during layout generation; note
-								// that the fitting_layouts_ratio
-								// doesn't matter here, so it's
-								// arbitrarily set to 1.0
-								this->evaluateAreaOutline(cost_sanity_check, 1.0);
-							}
+			// solution to be accepted, i.e., previously not reverted
+			if (accept) {
+				// memorize cost terms
+				chain.accepted_cost = cost;
+				// update ops count
+				chain.accepted_ops++;
+				// sum up cost for subsequent avg determination
+				chain.avg_cost += cur_cost;
+
+				// consider solution to be accepted only if it
+				// actually fits the fixed outline
+				if (cost.fits_fixed_outline) {
+
+					// the fitting cost is only determined for
+					// layouts which still fit after alignment,
+					// see below
+					fitting_cost_avail = false;
+
+					// consider to switch to SA phase two when
+					// first fitting solution is found
+					if (!chain.SA_phase_two) {
+
+						// however, cases w/ alignment
+						// require another check
+						if (this->opt_flags.alignment) {
+
+							// first, we need to re-determine
+							// the layout w/ enforced
+							// alignment which has not
+							// happened previously
+							this->generateLayout(corb, true);
+
+							// re-determine if layout still
+							// fits, after applying alignment
+							// during layout generation; note
+							// that the fitting_layouts_ratio
+							// doesn't matter here, so it's
+							// arbitrarily set to 1.0
+							this->blocks_geometry.update(this->blocks);
+							this->evaluateAreaOutline(cost_sanity_check, 1.0);
+						}
 
-							// for cases w/ alignment, only
-							// proceed when the layout fits;
-							// for cases w/o alignment,
-							// proceed anyway
-							if (
-								(this->opt_flags.alignment && cost_sanity_check.fits_fixed_outline) ||
-								!this->opt_flags.alignment
-							   ) {
-
-								// switch phase
-								SA_phase_two = SA_phase_two_init = true;
-
-								// re-calculate cost for new phase; assume
-								// fitting ratio 1.0 for initialization
-								// and for effective comparison of further
-								// fitting solutions; also initialize all
-								// max cost terms
-								fitting_cost =
-									this->evaluateLayout(corb.getAlignments(), 1.0, true, true).total_cost;
-
-								// also memorize in which iteration we
-								// found the first valid layout
-								i_valid_layout_found = i;
-
-								// logging
-								if (this->logMax()) {
-									std::cout << "SA> " << std::endl;
-								}
-								if (this->logMed()) {
-									std::cout << "SA> Phase II: optimizing within outline; switch cost function ..." << std::endl;
-								}
-								if (this->logMax()) {
-									std::cout << "SA> " << std::endl;
-								}
-
-								// update count of solutions fitting into outline
-								layout_fit_counter++;
+						// for cases w/ alignment, only
+						// proceed when the layout fits;
+						// for cases w/o alignment,
+						// proceed anyway
+						if (
+							(this->opt_flags.alignment && cost_sanity_check.fits_fixed_outline) ||
+							!this->opt_flags.alignment
+						   ) {
+
+							// switch phase
+							chain.SA_phase_two = SA_phase_two_init = true;
+
+							// re-calculate cost for new phase; assume
+							// fitting ratio 1.0 for initialization
+							// and for effective comparison of further
+							// fitting solutions; also initialize all
+							// max cost terms, unless a common
+							// normalization is maintained for
+							// parallel tempering
+							chain.accepted_cost =
+								this->evaluateLayout(corb.getAlignments(), 1.0, true, !this->parallel_tempering);
+							fitting_cost = chain.accepted_cost.total_cost;
+							fitting_cost_avail = true;
+
+							// also memorize in which iteration we
+							// found the first valid layout
+							chain.i_valid_layout_found = iteration;
+
+							// logging
+							if (this->logMax()) {
+								std::cout << "SA> " << std::endl;
+							}
+							if (this->logMed()) {
+								std::cout << "SA> Phase II: optimizing within outline; switch cost function ..." << std::endl;
+							}
+							if (this->logMax()) {
+								std::cout << "SA> " << std::endl;
 							}
-						}
-						// not first but any fitting solution; in
-						// order to compare different fitting
-						// solutions equally, consider cost terms
-						// w/ fitting ratio 1.0
-						else {
-							fitting_cost = cost.total_cost_fitting;
 
-							// update count of solutions
-							// fitting into outline
-							layout_fit_counter++;
+							// update count of solutions fitting into outline
+							chain.layout_fit_counter++;
 						}
+					}
+					// not first but any fitting solution; in
+					// order to compare different fitting
+					// solutions equally, consider cost terms
+					// w/ fitting ratio 1.0
+					else {
+						fitting_cost = cost.total_cost_fitting;
+						fitting_cost_avail = true;
+
+						// update count of solutions
+						// fitting into outline
+						chain.layout_fit_counter++;
+					}
 
-						// memorize best solution which fits into outline
-						if (fitting_cost < best_cost) {
+					// memorize best solution which fits into outline
+					if (fitting_cost_avail && fitting_cost < chain.best_cost) {
 
-							best_cost = fitting_cost;
-							corb.storeBestCBLs();
-							valid_layout_found = best_sol_found = true;
-						}
+						chain.best_cost = fitting_cost;
+						corb.storeBestCBLs();
+						chain.valid_layout_found = chain.best_sol_found = true;
 					}
 				}
+			}
 
-				// after phase transition, skip current global iteration
-				// in order to consider updated cost function
-				if (SA_phase_two_init) {
-					break;
-				}
-				// consider next loop iteration
-				else {
-					ii++;
-				}
+			// after phase transition, skip current global iteration
+			// in order to consider updated cost function
+			if (SA_phase_two_init) {
+				break;
+			}
+			// consider next loop iteration
+			else {
+				ii++;
+			}
+		}
+	}
+
+	// memorize ops count
+	chain.ops = ii;
+
+	// profiling
+	PhaseTimers::recordOps(SA_phase, evaluated_ops, SA_phase_start);
+
+	// determine ratio of solutions fitting into outline in current temp step;
+	// note that during the next temp step this ratio is fixed in order to
+	// avoid sudden changes of related cost terms during few iterations
+	if (chain.accepted_ops > 0) {
+		chain.fitting_layouts_ratio = static_cast<double>(chain.layout_fit_counter) / chain.accepted_ops;
+	}
+	else {
+		chain.fitting_layouts_ratio = 0.0;
+	}
+
+	// determine avg cost for temp step
+	if (chain.accepted_ops > 0) {
+		chain.avg_cost /= chain.accepted_ops;
+	}
+}
+
+void FloorPlanner::streamTelemetry(int const& iteration, SAChain const& chain, double const& best_cost, bool const& best_sol_found, double const& ops_per_sec) const {
+	Telemetry::Record record;
+
+	record.step = iteration;
+	record.temp = chain.cur_temp;
+	record.SA_phase = chain.SA_phase_two ? 2 : 1;
+	record.cooling_phase = chain.cooling_phase;
+	record.avg_cost = chain.avg_cost;
+	record.best_cost = best_cost;
+	record.new_best_sol_found = best_sol_found;
+	record.accepted_ops_ratio = (chain.ops > 0) ? static_cast<double>(chain.accepted_ops) / chain.ops : 0.0;
+	record.fitting_layouts_ratio = chain.fitting_layouts_ratio;
+	record.ops_per_sec = ops_per_sec;
+
+	// note that in SA phase one, only the area and outline cost is evaluated,
+	// other terms remain zero
+	record.cost_area_outline = chain.accepted_cost.area_outline;
+	record.cost_HPWL = chain.accepted_cost.HPWL;
+	record.cost_routing_util = chain.accepted_cost.routing_util;
+	record.cost_TSVs = chain.accepted_cost.TSVs;
+	record.cost_alignments = chain.accepted_cost.alignments;
+	record.cost_thermal = chain.accepted_cost.thermal;
+
+	this->telemetry->record(record);
+}
+
+// handler for multiple SA replicas; the replicas run independent SA chains on a pool
+// of threads, the best solution across all replicas is adopted by this floorplanner
+bool FloorPlanner::performSAReplicas(CorblivarCore& corb) {
+	std::vector< std::unique_ptr<FloorPlanner> > replica_fps;
+	std::vector< std::unique_ptr<CorblivarCore> > replica_corbs;
+	// note that std::vector<bool> is not safe for concurrent writes
+	std::vector<int> replica_valid;
+	unsigned r, reference, best;
+	double max_cost_thermal, max_cost_WL, max_cost_alignments, max_cost_routing_util;
+	int max_cost_TSVs;
+	double cost, best_cost;
+	bool valid_layout_found;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::performSAReplicas(" << &corb << ")" << std::endl;
+	}
+
+	// allocate replicas; use heap allocation since replicas are referred to by
+	// pointers, e.g., the RBOD dummy block and the cores' dies
+	for (r = 0; r < this->replicas; r++) {
+		replica_fps.emplace_back(new FloorPlanner());
+		replica_corbs.emplace_back(new CorblivarCore(this->IC.layers, this->blocks.size()));
+	}
+	replica_valid.assign(this->replicas, 0);
+
+	// thread pool; limited by available hardware threads
+	ThreadPool pool(std::min(this->replicas, std::thread::hardware_concurrency()), time(0));
+
+	if (this->logMin()) {
+		std::cout << "SA> Running " << this->replicas << " SA replicas on " << pool.size() << " threads ..." << std::endl;
+		std::cout << std::endl;
+	}
+
+	pool.run(this->replicas,
+		// lambda expression; one independent SA run for each replica
+		[&](unsigned const& cur) {
+
+			replica_fps[cur]->initReplica(*this, corb, *replica_corbs[cur], cur);
+
+			// independent, random initial solution
+			replica_corbs[cur]->initCorblivarRandomly(false, this->IC.layers, replica_fps[cur]->blocks, this->layoutOp.parameters.power_aware_block_handling);
+
+			replica_valid[cur] = replica_fps[cur]->performSA(*replica_corbs[cur]);
+		}
+	);
+
+	// determine best replica; the max cost values used for normalization differ
+	// for each replica, thus all best solutions are re-evaluated w/ the
+	// normalization of one reference replica
+	reference = best = this->replicas;
+	best_cost = 0.0;
+	for (r = 0; r < this->replicas; r++) {
+
+		if (!replica_valid[r]) {
+
+			if (this->logMin()) {
+				std::cout << "SA> Replica " << r << ": no fitting solution found" << std::endl;
+			}
+
+			continue;
+		}
+
+		if (reference == this->replicas) {
+			reference = r;
+		}
+
+		FloorPlanner& fp = *replica_fps[r];
+
+		// memorize replica's own normalization
+		max_cost_thermal = fp.max_cost_thermal;
+		max_cost_WL = fp.max_cost_WL;
+		max_cost_alignments = fp.max_cost_alignments;
+		max_cost_routing_util = fp.max_cost_routing_util;
+		max_cost_TSVs = fp.max_cost_TSVs;
+
+		// evaluate replica's best solution w/ reference normalization
+		fp.adoptMaxCost(*replica_fps[reference]);
+
+		replica_corbs[r]->applyBestCBLs(false);
+		fp.generateLayout(*replica_corbs[r], fp.opt_flags.alignment);
+		cost = fp.evaluateLayout(replica_corbs[r]->getAlignments(), 1.0, true).total_cost;
+
+		// restore replica's own normalization
+		fp.max_cost_thermal = max_cost_thermal;
+		fp.max_cost_WL = max_cost_WL;
+		fp.max_cost_alignments = max_cost_alignments;
+		fp.max_cost_routing_util = max_cost_routing_util;
+		fp.max_cost_TSVs = max_cost_TSVs;
+
+		if (this->logMin()) {
+			std::cout << "SA> Replica " << r << ": cost of best solution (normalized w/ replica " << reference << "): " << cost << std::endl;
+		}
+
+		if (best == this->replicas || cost < best_cost) {
+			best = r;
+			best_cost = cost;
+		}
+	}
+
+	valid_layout_found = (best != this->replicas);
+
+	// adopt best replica's solution; if there is none, adopt the first replica's
+	// temperature schedule for logging
+	if (valid_layout_found) {
+
+		corb.adoptBestCBLs(*replica_corbs[best], replica_fps[best]->blocks, this->blocks);
+
+		// also adopt the replica's normalization, required for final cost
+		this->adoptMaxCost(*replica_fps[best]);
+
+		this->tempSchedule = replica_fps[best]->tempSchedule;
+
+		if (this->logMin()) {
+			std::cout << "SA> Adopting best solution from replica " << best << std::endl;
+			std::cout << std::endl;
+		}
+	}
+	else {
+		this->tempSchedule = replica_fps[0]->tempSchedule;
+
+		if (this->logMin()) {
+			std::cout << std::endl;
+		}
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::performSAReplicas : " << valid_layout_found << std::endl;
+	}
+
+	return valid_layout_found;
+}
+
+// handler for parallel tempering; the replicas run at fixed temperatures along a
+// ladder and exchange their temperatures according to the Metropolis criterion after
+// each temperature step; the exchange of temperatures is equivalent to the exchange of
+// layouts but doesn't require to copy any layout data
+bool FloorPlanner::performParallelTempering(CorblivarCore& corb) {
+	std::vector< std::unique_ptr<FloorPlanner> > replica_fps;
+	std::vector< std::unique_ptr<CorblivarCore> > replica_corbs;
+	std::vector< std::vector<double> > cost_samples;
+	std::vector<int> innerLoopMax;
+	std::vector<double> init_temps;
+	std::vector<SAChain> chains;
+	// energies for exchange, i.e., cost of current layouts
+	std::vector<double> energies;
+	// temperature ladder; rung 0 is the hottest; also track which replica is
+	// currently assigned to which rung
+	std::vector<double> ladder;
+	std::vector<unsigned> rung_replica;
+	unsigned r, k, a, b, exchanges, exchange_attempts, best;
+	int i;
+	double delta, best_cost, cost_std_dev;
+	bool best_sol_found, best_cost_avail;
+	std::chrono::steady_clock::time_point step_start;
+	int step_ops;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::performParallelTempering(" << &corb << ")" << std::endl;
+	}
+
+	// allocate replicas; use heap allocation since replicas are referred to by
+	// pointers, e.g., the RBOD dummy block and the cores' dies
+	for (r = 0; r < this->replicas; r++) {
+		replica_fps.emplace_back(new FloorPlanner());
+		replica_corbs.emplace_back(new CorblivarCore(this->IC.layers, this->blocks.size()));
+	}
+	cost_samples.resize(this->replicas);
+	innerLoopMax.assign(this->replicas, 0);
+	init_temps.assign(this->replicas, 0.0);
+	chains.resize(this->replicas);
+	energies.assign(this->replicas, 0.0);
+
+	// persistent thread pool; limited by available hardware threads
+	ThreadPool pool(std::min(this->replicas, std::thread::hardware_concurrency()), time(0));
+
+	if (this->logMin()) {
+		std::cout << "SA> Parallel tempering w/ " << this->replicas << " replicas on " << pool.size() << " threads ..." << std::endl;
+	}
+
+	// init replicas and perform initial sampling
+	pool.run(this->replicas,
+		// lambda expression
+		[&](unsigned const& cur) {
+
+			FloorPlanner& fp = *replica_fps[cur];
+			CorblivarCore& fp_corb = *replica_corbs[cur];
+
+			fp.initReplica(*this, corb, fp_corb, cur);
+
+			// independent, random initial solution
+			fp_corb.initCorblivarRandomly(false, this->IC.layers, fp.blocks, this->layoutOp.parameters.power_aware_block_handling);
+
+			// handling of floorplacement benchmarks, see performSA
+			if (fp.layoutOp.parameters.floorplacement) {
+				fp_corb.sortCBLs(fp.logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
 			}
+
+			fp.initSA(fp_corb, cost_samples[cur], innerLoopMax[cur], init_temps[cur]);
 		}
+	);
+
+	// common cost normalization for all replicas, required for comparing the
+	// replicas' costs during exchanges; derived from the initial layout of
+	// the first replica
+	replica_fps[0]->generateLayout(*replica_corbs[0], this->opt_flags.alignment);
+	replica_fps[0]->evaluateLayout(replica_corbs[0]->getAlignments(), 1.0, true, true);
+	for (r = 1; r < this->replicas; r++) {
+		replica_fps[r]->adoptMaxCost(*replica_fps[0]);
+	}
 
-		// determine ratio of solutions fitting into outline in current temp step;
-		// note that during the next temp step this ratio is fixed in order to
-		// avoid sudden changes of related cost terms during few iterations
-		if (accepted_ops > 0) {
-			fitting_layouts_ratio = static_cast<double>(layout_fit_counter) / accepted_ops;
+	// temperature ladder; starting from the initial temperature of the first
+	// replica, i.e., derived from the std dev of its initial cost samples,
+	// which also provide the cost normalization for all replicas
+	//
+	// for the Metropolis exchange rule, a cost difference of one std dev is
+	// accepted w/ probability exp(-(1/T_k+1 - 1/T_k) * std_dev); thus, for a
+	// target acceptance rate, the inverse temperatures are spaced evenly by
+	// ln(1 / rate) / std_dev
+	//
+	// note that the samples refer to the phase-one cost, whereas exchanges
+	// are only performed for phase-two cost, see below; the latter cost is
+	// on a different scale, i.e., the actual acceptance rate differs from
+	// the target rate
+	cost_std_dev = Math::stdDev(cost_samples[0]);
+	for (k = 0; k < this->replicas; k++) {
+
+		if (k == 0 || cost_std_dev == 0.0) {
+			ladder.push_back(init_temps[0]);
 		}
 		else {
-			fitting_layouts_ratio = 0.0;
+			ladder.push_back(1.0 / (1.0 / init_temps[0] + k * std::log(1.0 / FloorPlanner::SA_PT_EXCHANGE_ACCEPTANCE) / cost_std_dev));
 		}
 
-		// determine avg cost for temp step
-		if (accepted_ops > 0) {
-			avg_cost /= accepted_ops;
+		rung_replica.push_back(k);
+	}
+
+	for (r = 0; r < this->replicas; r++) {
+		this->initSAChain(chains[r], ladder[r], cost_samples[r]);
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Temperature ladder: ";
+		for (double const& temp : ladder) {
+			std::cout << temp << " ";
 		}
+		std::cout << std::endl;
+	}
+	if (this->logMin()) {
+		std::cout << std::endl;
+	}
 
-		// determine accepted-ops ratio
-		accepted_ops_ratio = static_cast<double>(accepted_ops) / ii;
+	// reset temperature-schedule log; tracks the coldest rung
+	this->tempSchedule.clear();
+
+	exchanges = exchange_attempts = 0;
+	best_cost = 0.0;
+	best_cost_avail = false;
+
+	/// outer loop: temperature steps for all replicas, followed by exchanges
+	for (i = 1; i <= this->schedule.loop_limit; i++) {
+
+		step_start = std::chrono::steady_clock::now();
+
+		pool.run(this->replicas,
+			// lambda expression; one temperature step for each replica
+			[&](unsigned const& cur) {
+
+				FloorPlanner& fp = *replica_fps[cur];
+				CorblivarCore& fp_corb = *replica_corbs[cur];
+
+				fp.performSAStep(fp_corb, chains[cur], innerLoopMax[cur], i);
+
+				// determine energy of current layout; only required for
+				// phase two, see below; consider fitting ratio 1.0 in order
+				// to compare replicas equally
+				if (chains[cur].SA_phase_two) {
+					fp.generateLayout(fp_corb, fp.opt_flags.alignment);
+					energies[cur] = fp.evaluateLayout(fp_corb.getAlignments(), 1.0, true).total_cost;
+				}
+			}
+		);
+
+		// exchanges between neighboring rungs; alternate between even and odd
+		// pairs; only replicas in SA phase two are considered, since the
+		// exchange rule requires one cost function for both replicas, whereas
+		// the phase-one cost depends on each replica's own ratio of fitting
+		// layouts
+		for (k = i % 2; k + 1 < this->replicas; k += 2) {
+
+			a = rung_replica[k];
+			b = rung_replica[k + 1];
+
+			if (!chains[a].SA_phase_two || !chains[b].SA_phase_two) {
+				continue;
+			}
+
+			exchange_attempts++;
+
+			// Metropolis exchange rule: accept w/ probability
+			// min(1, exp((1/T_k - 1/T_k+1) * (E_a - E_b)))
+			delta = (1.0 / ladder[k] - 1.0 / ladder[k + 1]) * (energies[a] - energies[b]);
+
+			if (delta >= 0.0 || Math::randF(0, 1) < std::exp(delta)) {
+
+				std::swap(rung_replica[k], rung_replica[k + 1]);
+				chains[a].cur_temp = ladder[k + 1];
+				chains[b].cur_temp = ladder[k];
+
+				exchanges++;
+			}
+		}
+
+		// determine best solution across all replicas
+		best_sol_found = false;
+		for (r = 0; r < this->replicas; r++) {
+
+			if (chains[r].valid_layout_found && (!best_cost_avail || chains[r].best_cost < best_cost)) {
+				best_cost = chains[r].best_cost;
+				best_cost_avail = true;
+				best_sol_found = true;
+			}
+		}
 
 		if (this->logMax()) {
-			std::cout << "SA> Step done:" << std::endl;
+			std::cout << "SA> Optimization step " << i << "/" << this->schedule.loop_limit << " done:" << std::endl;
 			std::cout << "SA>  new best solution found: " << best_sol_found << std::endl;
-			std::cout << "SA>  accept-ops ratio: " << accepted_ops_ratio << std::endl;
-			std::cout << "SA>  valid-layouts ratio: " << fitting_layouts_ratio << std::endl;
-			std::cout << "SA>  avg cost: " << avg_cost << std::endl;
-			std::cout << "SA>  temp: " << cur_temp << std::endl;
+			std::cout << "SA>  best cost: " << best_cost << std::endl;
+			std::cout << "SA>  exchanges accepted / attempted: " << exchanges << " / " << exchange_attempts << std::endl;
 		}
 
-		// log temperature step
+		// log temperature step; consider the replica on the coldest rung
 		TempStep cur_step;
 		cur_step.step = i;
-		cur_step.temp = cur_temp;
-		cur_step.avg_cost = avg_cost;
+		cur_step.temp = ladder.back();
+		cur_step.avg_cost = chains[rung_replica.back()].avg_cost;
 		cur_step.new_best_sol_found = best_sol_found;
 		cur_step.cost_best_sol = best_cost;
 		this->tempSchedule.push_back(std::move(cur_step));
 
-		// update SA temperature
-		cooling_phase = this->updateTemp(cur_temp, i, i_valid_layout_found);
+		// stream telemetry for temperature step; consider the replica on the
+		// coldest rung, but the ops of all replicas
+		if (this->telemetry) {
 
-		// consider next outer step
-		i++;
+			step_ops = 0;
+			for (r = 0; r < this->replicas; r++) {
+				step_ops += chains[r].ops;
+			}
+
+			this->streamTelemetry(i, chains[rung_replica.back()], best_cost, best_sol_found,
+					step_ops / std::chrono::duration<double>(std::chrono::steady_clock::now() - step_start).count());
+		}
 	}
 
-	if (this->logMed()) {
-		std::cout << "SA> Done" << std::endl;
+	if (this->logMin()) {
+		std::cout << "SA> Done; exchanges accepted / attempted: " << exchanges << " / " << exchange_attempts << std::endl;
+	}
+
+	// determine best replica; similar to performSAReplicas, the best solution
+	// of each replica is generated and evaluated again, w/ the normalization
+	// shared by all replicas; only solutions fitting into the outline are
+	// considered
+	best = this->replicas;
+	best_cost = 0.0;
+	for (r = 0; r < this->replicas; r++) {
+
+		if (!chains[r].valid_layout_found) {
+
+			if (this->logMin()) {
+				std::cout << "SA> Replica " << r << ": no fitting solution found" << std::endl;
+			}
+
+			continue;
+		}
+
+		FloorPlanner& fp = *replica_fps[r];
+
+		replica_corbs[r]->applyBestCBLs(false);
+		fp.generateLayout(*replica_corbs[r], fp.opt_flags.alignment);
+		Cost cost = fp.evaluateLayout(replica_corbs[r]->getAlignments(), 1.0, true);
+
+		if (!cost.fits_fixed_outline) {
+
+			if (this->logMin()) {
+				std::cout << "SA> Replica " << r << ": best solution does not fit into outline" << std::endl;
+			}
+
+			continue;
+		}
+
+		if (this->logMin()) {
+			std::cout << "SA> Replica " << r << ": cost of best solution: " << cost.total_cost << std::endl;
+		}
+
+		if (best == this->replicas || cost.total_cost < best_cost) {
+			best = r;
+			best_cost = cost.total_cost;
+		}
+	}
+
+	// adopt best replica's solution
+	if (best != this->replicas) {
+
+		corb.adoptBestCBLs(*replica_corbs[best], replica_fps[best]->blocks, this->blocks);
+		this->adoptMaxCost(*replica_fps[best]);
+
+		if (this->logMin()) {
+			std::cout << "SA> Adopting best solution from replica " << best << "; cost: " << best_cost << std::endl;
+		}
+	}
+
+	if (this->logMin()) {
 		std::cout << std::endl;
 	}
 
 	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "<- FloorPlanner::performSA : " << valid_layout_found << std::endl;
+		std::cout << "<- FloorPlanner::performParallelTempering : " << (best != this->replicas) << std::endl;
 	}
 
-	return valid_layout_found;
+	return (best != this->replicas);
+}
+
+void FloorPlanner::initReplica(FloorPlanner const& master, CorblivarCore const& master_corb, CorblivarCore& corb, unsigned const& replica) {
+
+	// lambda expression; rebinds a block of the master to the related block of
+	// this replica
+	auto rebind = [&](Block const* b) -> Block const* {
+		if (b == &master.RBOD) {
+			return &this->RBOD;
+		}
+		else {
+			return &this->blocks[b->numerical_id];
+		}
+	};
+
+	// parameters
+	this->IC = master.IC;
+	this->benchmark = master.benchmark;
+	this->thermal_analyser_run = master.thermal_analyser_run;
+	this->replicas = 1;
+	this->parallel_tempering = master.parallel_tempering;
+	// the replicas already occupy the available hardware threads
+	this->parallel_dies = false;
+	this->IO_conf.power_density_file_avail = master.IO_conf.power_density_file_avail;
+	this->IO_conf.alignments_file_avail = master.IO_conf.alignments_file_avail;
+	this->schedule = master.schedule;
+	this->opt_flags = master.opt_flags;
+	this->weights = master.weights;
+	this->layoutOp = master.layoutOp;
+	this->power_stats = master.power_stats;
+	this->power_blurring_parameters = master.power_blurring_parameters;
+	this->thermal_solver_parameters = master.thermal_solver_parameters;
+	this->blocks_nets = master.blocks_nets;
+	this->netlist = master.netlist;
+
+	// only the first replica logs the SA progress, according to the master's log
+	// level, and streams telemetry; others remain quiet in order to not interleave
+	// their logs
+	this->log = FloorPlanner::LOG_MINIMAL;
+
+	// analyzers are not copied but re-initialized, since they hold pointers into
+	// their own maps
+	this->initThermalAnalyzer();
+	this->initRoutingUtilAnalyzer();
+
+	if (replica == 0) {
+		this->log = master.log;
+		this->telemetry = master.telemetry;
+	}
+
+	// layout state: blocks, including their geometry, layer and placement flags,
+	// are cloned for each replica
+	this->blocks = master.blocks;
+
+	// alignment requests are cloned as well and rebound to the cloned blocks
+	corb.editAlignments() = master_corb.getAlignments();
+	for (CorblivarAlignmentReq& req : corb.editAlignments()) {
+		req.s_i = rebind(req.s_i);
+		req.s_j = rebind(req.s_j);
+	}
+	for (Block& b : this->blocks) {
+		for (CorblivarAlignmentReq*& req : b.alignments_vertical_bus) {
+			req = &corb.editAlignments()[req - master_corb.getAlignments().data()];
+		}
+	}
+	corb.reserveAlignments();
+
+	// nets are cloned, since they hold layout-dependent mutable data; blocks are
+	// rebound whereas terminals are shared w/ the master
+	this->nets = master.nets;
+	for (Net& net : this->nets) {
+		for (Block const*& b : net.blocks) {
+			b = rebind(b);
+		}
+	}
 }
 
 FloorPlanner::TempPhase FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const {
@@ -395,6 +1038,7 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 	int accepted_ops;
 	bool op_success;
 	double cur_cost, prev_cost, cost_diff;
+	PhaseTimers::Clock::time_point sampling_start;
 
 	// reset max cost
 	this->max_cost_WL = 0.0;
@@ -418,6 +1062,9 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 		std::cout << "SA> Perform initial solution-space sampling..." << std::endl;
 	}
 
+	// profiling
+	sampling_start = PhaseTimers::now();
+
 	// init cost; ignore alignment here
 	this->generateLayout(corb);
 	cur_cost = this->evaluateLayout(corb.getAlignments()).total_cost;
@@ -452,6 +1099,8 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 			if (cost_diff > 0.0) {
 				// revert last op
 				layoutOp.performLayoutOp(corb, 1, false, true);
+				// also revert cached interconnects
+				this->rollbackInterconnectsCache();
 				// reset cost according to reverted CBL
 				cur_cost = prev_cost;
 			}
@@ -467,6 +1116,9 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 		}
 	}
 
+	// profiling
+	PhaseTimers::recordOps(PhaseTimers::SA_SAMPLING, i - 1, sampling_start);
+
 	// init SA parameter: start temp, depends on std dev of costs [Huan86, see
 	// Shahookar91]
 	init_temp = Math::stdDev(cost_samples) * this->schedule.temp_init_factor;
@@ -526,6 +1178,12 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 		// determine cost terms and overall cost
 		cost = this->evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
 
+		// determine steady-state temperatures, also considering the final TSV
+		// islands
+		if (this->thermal_solver_parameters.final_solution && this->IO_conf.power_density_file_avail) {
+			this->evaluateSteadyStateTemp();
+		}
+
 		// logging IO_conf.results; consider non-normalized, actual values
 		if (this->logMin()) {
 
@@ -601,77 +1259,474 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 					avg_bins_count += (*it_hotspots).second.bins.size();
 				}
 
-				avg_peak_temp /= this->clustering.hotspots.size();
-				avg_base_temp /= this->clustering.hotspots.size();
-				avg_temp_gradient /= this->clustering.hotspots.size();
-				avg_score /= this->clustering.hotspots.size();
-				avg_bins_count /= this->clustering.hotspots.size();
-
-				std::cout << "Corblivar>  Avg peak temp: " << avg_peak_temp << std::endl;
-				this->IO_conf.results << " Avg peak temp: " << avg_peak_temp << std::endl;
-				std::cout << "Corblivar>  Avg base temp: " << avg_base_temp << std::endl;
-				this->IO_conf.results << " Avg base temp: " << avg_base_temp << std::endl;
-				std::cout << "Corblivar>  Avg temp gradient: " << avg_temp_gradient << std::endl;
-				this->IO_conf.results << " Avg temp gradient: " << avg_temp_gradient << std::endl;
-				std::cout << "Corblivar>  Avg score: " << avg_score << std::endl;
-				this->IO_conf.results << " Avg score: " << avg_score << std::endl;
-				std::cout << "Corblivar>  Avg bin count: " << avg_bins_count << std::endl;
-				this->IO_conf.results << " Avg bin count: " << avg_bins_count << std::endl;
+				avg_peak_temp /= this->clustering.hotspots.size();
+				avg_base_temp /= this->clustering.hotspots.size();
+				avg_temp_gradient /= this->clustering.hotspots.size();
+				avg_score /= this->clustering.hotspots.size();
+				avg_bins_count /= this->clustering.hotspots.size();
+
+				std::cout << "Corblivar>  Avg peak temp: " << avg_peak_temp << std::endl;
+				this->IO_conf.results << " Avg peak temp: " << avg_peak_temp << std::endl;
+				std::cout << "Corblivar>  Avg base temp: " << avg_base_temp << std::endl;
+				this->IO_conf.results << " Avg base temp: " << avg_base_temp << std::endl;
+				std::cout << "Corblivar>  Avg temp gradient: " << avg_temp_gradient << std::endl;
+				this->IO_conf.results << " Avg temp gradient: " << avg_temp_gradient << std::endl;
+				std::cout << "Corblivar>  Avg score: " << avg_score << std::endl;
+				this->IO_conf.results << " Avg score: " << avg_score << std::endl;
+				std::cout << "Corblivar>  Avg bin count: " << avg_bins_count << std::endl;
+				this->IO_conf.results << " Avg bin count: " << avg_bins_count << std::endl;
+			}
+			this->IO_conf.results << std::endl;
+
+			std::cout << "Corblivar> Temp cost (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
+			this->IO_conf.results << "Temp cost (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
+			this->IO_conf.results << std::endl;
+
+			if (!this->thermal_solver_result.temp.empty()) {
+
+				std::cout << "Corblivar> Steady-state temp (thermal solver; max temp for lowest layer [K]): " << this->thermal_solver_result.max_temp << std::endl;
+				this->IO_conf.results << "Steady-state temp (thermal solver; max temp for lowest layer [K]): " << this->thermal_solver_result.max_temp << std::endl;
+				std::cout << "Corblivar>  Max temp for whole stack [K]: " << this->thermal_solver_result.max_temp_stack << std::endl;
+				this->IO_conf.results << " Max temp for whole stack [K]: " << this->thermal_solver_result.max_temp_stack << std::endl;
+				std::cout << "Corblivar>  Solver iterations: " << this->thermal_solver_result.iterations << std::endl;
+				this->IO_conf.results << " Solver iterations: " << this->thermal_solver_result.iterations << std::endl;
+				std::cout << "Corblivar>  Solver relative residual: " << this->thermal_solver_result.residual << std::endl;
+				this->IO_conf.results << " Solver relative residual: " << this->thermal_solver_result.residual << std::endl;
+
+				if (!this->thermal_solver_result.converged) {
+					std::cout << "Corblivar>  Note: solver did not converge; temperatures are not reliable" << std::endl;
+					this->IO_conf.results << " Note: solver did not converge; temperatures are not reliable" << std::endl;
+				}
+				this->IO_conf.results << std::endl;
+			}
+
+			std::cout << std::endl;
+		}
+	}
+
+	// generate temperature-schedule data
+	IO::writeTempSchedule(*this);
+
+	// generate floorplan plots
+	IO::writeFloorplanGP(*this, corb.getAlignments());
+
+	// generate Corblivar data if solution file is used as output
+	if (handle_corblivar && this->IO_conf.solution_out.is_open()) {
+		this->IO_conf.solution_out << corb.CBLsString() << std::endl;
+		this->IO_conf.solution_out.close();
+
+		// delete file in case no valid solution was generated
+		if (!valid_solution) {
+			remove(this->IO_conf.solution_file.c_str());
+		}
+	}
+
+	// thermal-analysis files
+	if ((!handle_corblivar || valid_solution) && this->IO_conf.power_density_file_avail) {
+		// generate power, thermal, routing-utilization and TSV-density maps
+		IO::writeMaps(*this);
+		// generate HotSpot files
+		IO::writeHotSpotFiles(*this);
+	}
+
+	// profiling; report for hot paths and SA phases
+	if (PhaseTimers::PROFILE) {
+
+		if (this->logMin()) {
+
+			this->IO_conf.results << "Performance report (times of phases include nested phases):" << std::endl;
+			for (PhaseTimers::PhaseStats const& stats : PhaseTimers::mergedPhaseStats()) {
+				this->IO_conf.results << " " << stats.name << ": calls = " << stats.calls;
+				this->IO_conf.results << ", total [s] = " << stats.total;
+				this->IO_conf.results << ", mean [us] = " << 1.0e6 * stats.mean;
+				this->IO_conf.results << ", p99 [us] = " << 1.0e6 * stats.p99 << std::endl;
+			}
+			for (PhaseTimers::SAPhaseStats const& stats : PhaseTimers::mergedSAPhaseStats()) {
+				this->IO_conf.results << " SA " << stats.name << ": layout ops = " << stats.ops;
+				this->IO_conf.results << ", time [s] = " << stats.time;
+				this->IO_conf.results << ", ops per second = " << stats.ops_per_sec << std::endl;
+			}
+
+			// note that only rejected hits save time, accepted hits are
+			// evaluated again
+			for (PhaseTimers::CacheStats const& stats : PhaseTimers::mergedCacheStats()) {
+				this->IO_conf.results << " Evaluation cache, SA " << stats.name << ": lookups = " << stats.lookups;
+				this->IO_conf.results << ", hits = " << stats.hits;
+				this->IO_conf.results << ", hit rate = " << stats.hit_rate;
+				this->IO_conf.results << ", time saved by rejected hits [s] = " << stats.time_saved << std::endl;
+			}
+			this->IO_conf.results << std::endl;
+		}
+
+		// machine-readable report
+		IO::writePerformanceReport(*this);
+	}
+
+	// determine overall runtime
+	ftime(&end);
+	if (this->logMin()) {
+		runtime << "Runtime: " << (1000.0 * (end.time - this->time_start.time) + (end.millitm - this->time_start.millitm)) / 1000.0 << " s";
+		std::cout << "Corblivar> " << runtime.str() << std::endl;
+		this->IO_conf.results << runtime.str() << std::endl;
+	}
+
+	// close IO_conf.results file
+	this->IO_conf.results.close();
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::finalize" << std::endl;
+	}
+}
+
+// fitting of power-blurring parameters against a reference thermal map of the given
+// solution, i.e., against HotSpot's map if available, otherwise against the thermal
+// solver's map; Nelder-Mead simplex search where all candidates of one step are
+// evaluated concurrently
+void FloorPlanner::fitThermalParameters(CorblivarCore& corb) {
+	// fitted parameters: impulse factor, impulse-scaling exponent, mask-boundary
+	// value, power-density scaling factors for padding zone and TSV regions; the
+	// temperature offset is determined directly for each candidate
+	static constexpr unsigned PARAMETERS = 5;
+	// coefficients for reflection, expansion, contraction and shrinking
+	static constexpr double NM_REFLECTION = 1.0;
+	static constexpr double NM_EXPANSION = 2.0;
+	static constexpr double NM_CONTRACTION = 0.5;
+	static constexpr double NM_SHRINK = 0.5;
+	// POD for candidates
+	struct Candidate {
+		std::array<double, PARAMETERS> v;
+		double error;
+		double temp_offset;
+	};
+
+	std::vector< std::vector<double> > reference;
+	std::vector<ThermalAnalyzer::PowerMap> unscaled_power_maps;
+	std::vector<ThermalAnalyzer> analyzers;
+	std::vector<Candidate> simplex, candidates;
+	ThermalAnalyzer::MaskParameters parameters;
+	Candidate init, centroid;
+	unsigned evaluations, restart;
+	unsigned i, p;
+	double x, y;
+	bool shrink;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::fitThermalParameters(" << &corb << ")" << std::endl;
+	}
+
+	if (this->logMin()) {
+		std::cout << "Corblivar> Fitting power-blurring parameters ..." << std::endl;
+	}
+
+	// generate layout and derive TSVs, similar to finalize
+	corb.applyBestCBLs(false);
+	this->generateLayout(corb, this->opt_flags.alignment);
+
+	if (this->IC.outline_shrink) {
+
+		x = y = 0.0;
+		for (Block const& b : this->blocks) {
+			x = std::max(x, b.bb.ur.x);
+			y = std::max(y, b.bb.ur.y);
+		}
+
+		this->resetDieProperties(x, y);
+	}
+
+	this->evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
+
+	// reference thermal map; HotSpot's map or thermal solver's map of the lowest
+	// active Si layer
+	if (IO::parseHotSpotThermalMap(*this, reference)) {
+
+		if (this->logMin()) {
+			std::cout << "Corblivar>  Reference: HotSpot thermal map" << std::endl;
+		}
+	}
+	else {
+		this->evaluateSteadyStateTemp();
+		reference = this->thermal_solver_result.temp[0];
+
+		if (this->logMin()) {
+			std::cout << "Corblivar>  Reference: thermal-solver thermal map" << std::endl;
+		}
+	}
+
+	// unscaled power maps, i.e., w/ both scaling factors set to 1.0; to be
+	// generated only once
+	parameters = this->power_blurring_parameters;
+	parameters.power_density_scaling_padding_zone = 1.0;
+	parameters.power_density_scaling_TSV_region = 1.0;
+
+	this->blocks_geometry.update(this->blocks);
+	this->thermalAnalyzer.generatePowerMaps(this->IC.layers, this->blocks_geometry, this->getOutline(), parameters);
+	this->thermalAnalyzer.adaptPowerMaps(this->IC.layers, this->TSVs, this->nets, parameters);
+	unscaled_power_maps = this->thermalAnalyzer.getPowerMaps();
+
+	// separate thermal analyzers for concurrent evaluation of candidates; at most
+	// PARAMETERS candidates are evaluated at once (shrinking of simplex)
+	analyzers.resize(PARAMETERS + 1);
+	for (ThermalAnalyzer& analyzer : analyzers) {
+		analyzer.setThermalMapDim(this->thermalAnalyzer.getThermalMapDim());
+		analyzer.initPowerMaps(this->IC.layers, this->getOutline());
+		analyzer.initThermalMap(this->getOutline());
+	}
+
+	ThreadPool pool(std::min(PARAMETERS + 1, std::thread::hardware_concurrency()), time(0));
+
+	// lambda expression; determines the RMS error of candidate's thermal map w/
+	// respect to the reference map, along w/ the (optimal) temperature offset;
+	// candidates violating the parameters' constraints are assigned max error
+	auto evaluate = [&](Candidate& cand, ThermalAnalyzer& analyzer) {
+		ThermalAnalyzer::MaskParameters cand_parameters;
+		ThermalAnalyzer::ThermalAnalysisResult result;
+		int dim, x, y;
+		double diff, error;
+
+		cand.error = cand.temp_offset = std::numeric_limits<double>::max();
+
+		// constraints, see IO::parseParametersFiles
+		if (
+				cand.v[0] <= 0.0 || cand.v[1] <= 0.0 || cand.v[2] <= 0.0 || cand.v[2] >= cand.v[0] ||
+				cand.v[3] < 1.0 || cand.v[4] < 0.0 || cand.v[4] > 1.0
+		   ) {
+			return;
+		}
+
+		cand_parameters = this->power_blurring_parameters;
+		cand_parameters.impulse_factor = cand.v[0];
+		cand_parameters.impulse_factor_scaling_exponent = cand.v[1];
+		cand_parameters.mask_boundary_value = cand.v[2];
+		cand_parameters.power_density_scaling_padding_zone = cand.v[3];
+		cand_parameters.power_density_scaling_TSV_region = cand.v[4];
+		cand_parameters.temp_offset = 0.0;
+
+		analyzer.initThermalMasks(this->IC.layers, false, cand_parameters);
+		analyzer.scalePowerMaps(this->IC.layers, unscaled_power_maps, cand_parameters);
+		analyzer.performPowerBlurring(result, this->IC.layers, cand_parameters);
+
+		dim = analyzer.getThermalMapDim();
+
+		// temperature offset; mean deviation from reference map
+		cand.temp_offset = 0.0;
+		for (x = 0; x < dim; x++) {
+			for (y = 0; y < dim; y++) {
+				cand.temp_offset += reference[x][y] - (*result.thermal_map)[x][y].temp;
+			}
+		}
+		cand.temp_offset /= dim * dim;
+
+		// RMS error
+		error = 0.0;
+		for (x = 0; x < dim; x++) {
+			for (y = 0; y < dim; y++) {
+				diff = (*result.thermal_map)[x][y].temp + cand.temp_offset - reference[x][y];
+				error += diff * diff;
+			}
+		}
+		cand.error = std::sqrt(error / (dim * dim));
+	};
+
+	// lambda expression; evaluate set of candidates concurrently
+	auto evaluateAll = [&](std::vector<Candidate>& cands, unsigned const& offset) {
+
+		pool.run(cands.size() - offset, [&](unsigned const& c) {
+				evaluate(cands[offset + c], analyzers[c]);
+			});
+
+		evaluations += cands.size() - offset;
+	};
+
+	// lambda expression; affine combination of vertices, i.e., a + factor * (a - b)
+	auto combine = [&](Candidate const& a, Candidate const& b, double const& factor) {
+		Candidate ret;
+
+		for (p = 0; p < PARAMETERS; p++) {
+			ret.v[p] = a.v[p] + factor * (a.v[p] - b.v[p]);
+		}
+
+		return ret;
+	};
+
+	// initial vertex; parameters of config file
+	init.v = {{
+		this->power_blurring_parameters.impulse_factor,
+		this->power_blurring_parameters.impulse_factor_scaling_exponent,
+		this->power_blurring_parameters.mask_boundary_value,
+		this->power_blurring_parameters.power_density_scaling_padding_zone,
+		this->power_blurring_parameters.power_density_scaling_TSV_region
+	}};
+
+	evaluations = 0;
+	candidates.assign(1, init);
+	evaluateAll(candidates, 0);
+	init = candidates[0];
+
+	if (this->logMin()) {
+		std::cout << "Corblivar>  Initial RMS error [K]: " << init.error << std::endl;
+	}
+
+	for (restart = 0; restart <= FloorPlanner::THERMAL_FITTING_RESTARTS; restart++) {
+
+		// initial simplex around best vertex; steps are taken in the direction
+		// away from the constraints' limits
+		simplex.assign(1, init);
+		for (p = 0; p < PARAMETERS; p++) {
+
+			simplex.push_back(init);
+
+			if (p == 4 && init.v[p] > 0.5) {
+				simplex.back().v[p] -= FloorPlanner::THERMAL_FITTING_INIT_STEP * init.v[p];
+			}
+			else if (init.v[p] == 0.0) {
+				simplex.back().v[p] = FloorPlanner::THERMAL_FITTING_INIT_STEP;
+			}
+			else {
+				simplex.back().v[p] += FloorPlanner::THERMAL_FITTING_INIT_STEP * init.v[p];
+			}
+		}
+		evaluateAll(simplex, 1);
+
+		while (evaluations < FloorPlanner::THERMAL_FITTING_EVALUATIONS) {
+
+			// order vertices by error
+			std::sort(simplex.begin(), simplex.end(), [](Candidate const& a, Candidate const& b) {
+					return a.error < b.error;
+				});
+
+			// convergence; spread of errors
+			if (simplex.back().error - simplex.front().error <= FloorPlanner::THERMAL_FITTING_TOLERANCE * simplex.front().error) {
+				break;
+			}
+
+			// centroid of all but worst vertex
+			centroid.v.fill(0.0);
+			for (i = 0; i < PARAMETERS; i++) {
+				for (p = 0; p < PARAMETERS; p++) {
+					centroid.v[p] += simplex[i].v[p] / PARAMETERS;
+				}
+			}
+
+			// candidates: reflection, expansion, outside and inside contraction;
+			// evaluated speculatively at once
+			candidates.clear();
+			candidates.push_back(combine(centroid, simplex.back(), NM_REFLECTION));
+			candidates.push_back(combine(centroid, simplex.back(), NM_REFLECTION * NM_EXPANSION));
+			candidates.push_back(combine(centroid, simplex.back(), NM_REFLECTION * NM_CONTRACTION));
+			candidates.push_back(combine(centroid, simplex.back(), -NM_CONTRACTION));
+			evaluateAll(candidates, 0);
+
+			shrink = false;
+
+			// reflection better than best vertex; consider expansion
+			if (candidates[0].error < simplex.front().error) {
+
+				if (candidates[1].error < candidates[0].error) {
+					simplex.back() = candidates[1];
+				}
+				else {
+					simplex.back() = candidates[0];
+				}
+			}
+			// reflection better than second-worst vertex
+			else if (candidates[0].error < simplex[PARAMETERS - 1].error) {
+				simplex.back() = candidates[0];
+			}
+			// reflection better than worst vertex; consider outside contraction
+			else if (candidates[0].error < simplex.back().error) {
+
+				if (candidates[2].error <= candidates[0].error) {
+					simplex.back() = candidates[2];
+				}
+				else {
+					shrink = true;
+				}
+			}
+			// consider inside contraction
+			else {
+				if (candidates[3].error < simplex.back().error) {
+					simplex.back() = candidates[3];
+				}
+				else {
+					shrink = true;
+				}
 			}
-			this->IO_conf.results << std::endl;
 
-			std::cout << "Corblivar> Temp cost (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
-			this->IO_conf.results << "Temp cost (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
-			this->IO_conf.results << std::endl;
+			// shrink simplex towards best vertex
+			if (shrink) {
 
-			std::cout << std::endl;
+				for (i = 1; i <= PARAMETERS; i++) {
+					simplex[i] = combine(simplex.front(), simplex[i], -NM_SHRINK);
+				}
+				evaluateAll(simplex, 1);
+			}
 		}
-	}
-
-	// generate temperature-schedule data
-	IO::writeTempSchedule(*this);
 
-	// generate floorplan plots
-	IO::writeFloorplanGP(*this, corb.getAlignments());
+		// memorize best vertex
+		std::sort(simplex.begin(), simplex.end(), [](Candidate const& a, Candidate const& b) {
+				return a.error < b.error;
+			});
 
-	// generate Corblivar data if solution file is used as output
-	if (handle_corblivar && this->IO_conf.solution_out.is_open()) {
-		this->IO_conf.solution_out << corb.CBLsString() << std::endl;
-		this->IO_conf.solution_out.close();
+		if (simplex.front().error < init.error) {
+			init = simplex.front();
+		}
 
-		// delete file in case no valid solution was generated
-		if (!valid_solution) {
-			remove(this->IO_conf.solution_file.c_str());
+		if (this->logMed()) {
+			std::cout << "Corblivar>  Restart " << restart << "; RMS error [K]: " << init.error << "; evaluations: " << evaluations << std::endl;
 		}
 	}
 
-	// thermal-analysis files
-	if ((!handle_corblivar || valid_solution) && this->IO_conf.power_density_file_avail) {
-		// generate power, thermal, routing-utilization and TSV-density maps
-		IO::writeMaps(*this);
-		// generate HotSpot files
-		IO::writeHotSpotFiles(*this);
-	}
+	// apply fitted parameters
+	this->power_blurring_parameters.impulse_factor = init.v[0];
+	this->power_blurring_parameters.impulse_factor_scaling_exponent = init.v[1];
+	this->power_blurring_parameters.mask_boundary_value = init.v[2];
+	this->power_blurring_parameters.power_density_scaling_padding_zone = init.v[3];
+	this->power_blurring_parameters.power_density_scaling_TSV_region = init.v[4];
+	this->power_blurring_parameters.temp_offset = init.temp_offset;
 
-	// determine overall runtime
-	ftime(&end);
+	this->thermalAnalyzer.initThermalMasks(this->IC.layers, false, this->power_blurring_parameters);
+
+	// logging; config-file values
 	if (this->logMin()) {
-		runtime << "Runtime: " << (1000.0 * (end.time - this->time_start.time) + (end.millitm - this->time_start.millitm)) / 1000.0 << " s";
-		std::cout << "Corblivar> " << runtime.str() << std::endl;
-		this->IO_conf.results << runtime.str() << std::endl;
-	}
+		std::cout << "Corblivar> Done; RMS error [K]: " << init.error << "; evaluations: " << evaluations << std::endl;
+		std::cout << "Corblivar> Fitted power-blurring parameters:" << std::endl;
+		std::cout << "Corblivar>  Impulse factor: " << init.v[0] << std::endl;
+		std::cout << "Corblivar>  Impulse scaling-factor: " << init.v[1] << std::endl;
+		std::cout << "Corblivar>  Mask-boundary value: " << init.v[2] << std::endl;
+		std::cout << "Corblivar>  Power-density scaling factor (padding zone): " << init.v[3] << std::endl;
+		std::cout << "Corblivar>  Power-density down-scaling factor (TSV regions): " << init.v[4] << std::endl;
+		std::cout << "Corblivar>  Temperature offset: " << init.temp_offset << std::endl;
+		std::cout << std::endl;
 
-	// close IO_conf.results file
-	this->IO_conf.results.close();
+		this->IO_conf.results << "Fitted power-blurring parameters (RMS error [K]: " << init.error << "):" << std::endl;
+		this->IO_conf.results << " Impulse factor: " << init.v[0] << std::endl;
+		this->IO_conf.results << " Impulse scaling-factor: " << init.v[1] << std::endl;
+		this->IO_conf.results << " Mask-boundary value: " << init.v[2] << std::endl;
+		this->IO_conf.results << " Power-density scaling factor (padding zone): " << init.v[3] << std::endl;
+		this->IO_conf.results << " Power-density down-scaling factor (TSV regions): " << init.v[4] << std::endl;
+		this->IO_conf.results << " Temperature offset: " << init.temp_offset << std::endl;
+		this->IO_conf.results << std::endl;
+	}
 
 	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "<- FloorPlanner::finalize" << std::endl;
+		std::cout << "<- FloorPlanner::fitThermalParameters" << std::endl;
 	}
 }
 
 bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_alignment) {
 	bool ret;
 
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::GENERATE_LAYOUT);
+
+	// w/o alignment, the dies are independent; handle them in parallel if desired
+	if (this->parallel_dies && !perform_alignment && this->IC.layers > 1) {
+		return this->generateLayoutParallelDies(corb);
+	}
+
+	// outlines of dies are to be determined during evaluation
+	this->dies_outline_avail = false;
+
 	// generate layout
 	ret = corb.generateLayout(perform_alignment);
 
@@ -713,15 +1768,125 @@ bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_align
 	return ret;
 }
 
+bool FloorPlanner::generateLayoutParallelDies(CorblivarCore& corb) {
+	std::vector<int> dies_invalid;
+	bool annotate_alignments;
+
+	// init worker threads on first run; limited by available hardware threads
+	if (!this->dies_pool) {
+		this->dies_pool.reset(new ThreadPool(std::min(static_cast<unsigned>(this->IC.layers), std::thread::hardware_concurrency()), 0));
+	}
+
+	this->dies_outline_x.assign(this->IC.layers, 0.0);
+	this->dies_outline_y.assign(this->IC.layers, 0.0);
+	dies_invalid.assign(this->IC.layers, 0);
+
+	// annotating alignment success/failure in blocks, as required for packing,
+	// considers all dies; thus, the layouts of all dies have to be generated
+	// before packing
+	annotate_alignments = this->opt_flags.alignment && this->layoutOp.parameters.packing_iterations > 0;
+
+	// lambda expression; packing and determination of outline for one die; each
+	// die is handled by one worker only, and blocks are not shared across dies
+	auto packDie = [&](unsigned const& d) {
+
+		CorblivarDie& die = corb.editDie(d);
+
+		// sanity check for empty dies
+		if (!die.getCBL().empty()) {
+
+			for (int i = 1; i <= this->layoutOp.parameters.packing_iterations; i++) {
+				die.performPacking(Direction::HORIZONTAL);
+				die.performPacking(Direction::VERTICAL);
+			}
+		}
+
+		// determine outline of die, as evaluateAreaOutline would do
+		for (CornerBlockList::Tuple const& tuple : die.getCBL().getTuples()) {
+			this->dies_outline_x[d] = std::max(this->dies_outline_x[d], tuple.S->bb.ur.x);
+			this->dies_outline_y[d] = std::max(this->dies_outline_y[d], tuple.S->bb.ur.y);
+		}
+
+		// dbg: sanity check for valid layout
+		if (FloorPlanner::DBG_LAYOUT) {
+			dies_invalid[d] = die.debugLayout();
+		}
+	};
+
+	if (annotate_alignments) {
+
+		// generate layout
+		this->dies_pool->run(this->IC.layers, [&](unsigned const& d) {
+				corb.editDie(d).generateLayout();
+			});
+
+		// annotate alignment success/failure; ignore related cost and don't
+		// derive TSVs
+		Cost dummy;
+		this->evaluateAlignments(dummy, corb.getAlignments(), false);
+
+		// perform packing
+		this->dies_pool->run(this->IC.layers, packDie);
+	}
+	else {
+		// generate layout and perform packing at once
+		this->dies_pool->run(this->IC.layers, [&](unsigned const& d) {
+				corb.editDie(d).generateLayout();
+				packDie(d);
+			});
+	}
+
+	this->dies_outline_avail = true;
+
+	// dbg: if true, the layout is buggy, i.e., invalid
+	for (int const& invalid : dies_invalid) {
+		if (invalid) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 // adaptive cost model w/ two phases: first phase considers only cost for packing into
 // outline, second phase considers further factors like WL, thermal distr, etc.
-FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& SA_phase_two, bool const& set_max_cost, bool const& finalize) {
+FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& SA_phase_two, bool const& set_max_cost, bool const& finalize, double const& cost_ceiling) {
 	Cost cost;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "-> FloorPlanner::evaluateLayout(" << &alignments << ", " << fitting_layouts_ratio << ", " << SA_phase_two << ", " << set_max_cost << ", " << finalize << ")" << std::endl;
+		std::cout << "-> FloorPlanner::evaluateLayout(" << &alignments << ", " << fitting_layouts_ratio << ", " << SA_phase_two << ", " << set_max_cost << ", " << finalize << ", " << cost_ceiling << ")" << std::endl;
 	}
 
+	cost.exceeds_ceiling = false;
+
+	// new cost normalization; previously cached evaluations are not comparable
+	if (set_max_cost || finalize) {
+		this->clearEvaluationCache();
+	}
+
+	// lambda expression; for staged evaluation: all cost terms are non-negative,
+	// thus the sum of the weighted terms determined so far is a lower bound for the
+	// total cost; once this bound exceeds the ceiling, the layout would be rejected
+	// anyway and the remaining terms are not required
+	auto exceedsCeiling = [&](double const& lower_bound) -> bool {
+
+		if (lower_bound > cost_ceiling) {
+
+			cost.exceeds_ceiling = true;
+			cost.total_cost = cost.total_cost_fitting = lower_bound;
+
+			if (FloorPlanner::DBG_CALLS_SA) {
+				std::cout << "<- FloorPlanner::evaluateLayout : aborted; lower bound " << lower_bound << " exceeds ceiling" << std::endl;
+			}
+		}
+
+		return cost.exceeds_ceiling;
+	};
+
+	// snapshot of the generated layout's geometry; all cost terms below consider
+	// the blocks' geometry only via this snapshot
+	this->blocks_geometry.update(this->blocks);
+
 	// phase one: consider only cost for packing into outline
 	if (!SA_phase_two) {
 
@@ -733,11 +1898,21 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 		// invert weight of area and outline cost since it's the only cost term
 		cost.total_cost = (1.0 / FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE) * cost.area_outline;
 	}
-	// phase two: consider further cost factors
+	// phase two: consider further cost factors; the terms are evaluated in stages,
+	// cheapest first
 	else {
 		// area and outline cost, already weighted w/ global weight factor
 		this->evaluateAreaOutline(cost, fitting_layouts_ratio);
 
+		// first stage; note that interconnects are not evaluated yet, i.e., the
+		// cache still relates to the previous layout and must not be rolled back
+		if (exceedsCeiling(cost.area_outline)) {
+
+			this->commitInterconnectsCache();
+
+			return cost;
+		}
+
 		// determine interconnects cost; also determines hotspot regions and
 		// clusters signal TSVs accordingly
 		//
@@ -748,12 +1923,24 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 		else if (this->opt_flags.interconnects) {
 			this->evaluateInterconnects(cost, alignments, set_max_cost);
 		}
-		// no optimization considered, reset cost to zero
+		// no optimization considered, reset cost to zero; also reset TSVs,
+		// otherwise islands from evaluateAlignments would accumulate
 		else {
 			cost.HPWL = cost.HPWL_actual_value = 0.0;
 			cost.routing_util = cost.routing_util_actual_value = 0.0;
 			cost.TSVs = cost.TSVs_actual_value = 0;
 			cost.TSVs_area_deadspace_ratio = 0.0;
+
+			this->TSVs.clear();
+		}
+
+		// second stage
+		if (exceedsCeiling(cost.area_outline + FloorPlanner::SA_COST_WEIGHT_OTHERS * (
+						this->weights.WL * cost.HPWL
+						+ this->weights.routing_util * cost.routing_util
+						+ this->weights.TSVs * cost.TSVs
+					))) {
+			return cost;
 		}
 
 		// cost for failed alignments (i.e., alignment mismatches)
@@ -773,6 +1960,16 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 			cost.alignments = cost.alignments_actual_value = 0.0;
 		}
 
+		// third stage; the thermal analysis remains
+		if (exceedsCeiling(cost.area_outline + FloorPlanner::SA_COST_WEIGHT_OTHERS * (
+						this->weights.WL * cost.HPWL
+						+ this->weights.routing_util * cost.routing_util
+						+ this->weights.TSVs * cost.TSVs
+						+ this->weights.alignment * cost.alignments
+					))) {
+			return cost;
+		}
+
 		// temperature-distribution cost and profile
 		//
 		// note that vertical buses and TSV islands impact heat conduction, thus
@@ -781,7 +1978,7 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 		//
 		// for finalize calls, we need to initialize the max_cost
 		if (finalize) {
-			this->evaluateThermalDistr(cost, true);
+			this->evaluateThermalDistr(cost, true, false);
 		}
 		else if (this->opt_flags.thermal) {
 			this->evaluateThermalDistr(cost, set_max_cost);
@@ -802,7 +1999,7 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 			this->evaluateInterconnects(cost, alignments);
 			this->evaluateAlignments(cost, alignments, true, false, true);
 
-			this->evaluateThermalDistr(cost);
+			this->evaluateThermalDistr(cost, false, false);
 		}
 
 		// determine total cost; weight and sum up cost terms
@@ -846,18 +2043,13 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 	return cost;
 }
 
-void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost) {
-
-	// generate power maps based on layout and blocks' power densities
-	this->thermalAnalyzer.generatePowerMaps(this->IC.layers, this->blocks,
-			this->getOutline(), this->power_blurring_parameters);
+void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost, bool const& incremental) {
 
-	// adapt power maps to account for TSVs' impact
-	this->thermalAnalyzer.adaptPowerMaps(this->IC.layers, this->TSVs, this->nets, this->power_blurring_parameters);
-
-	// perform actual thermal analysis
-	this->thermalAnalyzer.performPowerBlurring(this->thermal_analysis, this->IC.layers,
-			this->power_blurring_parameters);
+	// perform actual thermal analysis; incremental analysis considers only changes
+	// of blocks and TSV islands since the previous analysis
+	this->thermalAnalyzer.performThermalAnalysis(this->thermal_analysis, this->IC.layers, this->blocks_geometry, this->TSVs, this->nets,
+			this->getOutline(), this->power_blurring_parameters, incremental);
+	this->thermal_analyses++;
 
 	// memorize max cost; initial sampling
 	if (set_max_cost) {
@@ -870,6 +2062,26 @@ void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost) {
 	cost.thermal_actual_value = this->thermal_analysis.max_temp;
 };
 
+// steady-state temperatures of current layout, determined by thermal solver; TSV
+// densities are considered as modeled for the power blurring
+void FloorPlanner::evaluateSteadyStateTemp() {
+
+	this->thermalSolver.solve(this->thermal_solver_result, this->IC.layers, this->thermalAnalyzer.getThermalMapDim(), this->blocks,
+			this->getOutline(), this->thermal_solver_parameters,
+			// lambda expression; TSV densities of thermal-map bins
+			[&](int const& layer, int const& x, int const& y) -> double {
+				// thermal-analyzer runs consider a uniform TSV density,
+				// similar to the HotSpot files
+				if (this->thermal_analyser_run) {
+					return this->power_blurring_parameters.TSV_density;
+				}
+				else {
+					return this->thermalAnalyzer.getTSVDensity(layer, x, y);
+				}
+			}
+		);
+}
+
 // adaptive cost model: terms for area and AR mismatch are _mutually_ depending on ratio
 // of feasible solutions (solutions fitting into outline), leveraged from Chen et al 2006
 // ``Modern floorplanning based on B*-Tree and fast simulated annealing''
@@ -879,9 +2091,16 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 	double max_outline_x;
 	double max_outline_y;
 	int i;
+	unsigned b;
 	std::vector<double> dies_AR;
 	std::vector<double> dies_area;
+	std::vector<double> dies_outline_x;
+	std::vector<double> dies_outline_y;
 	bool layout_fits_in_fixed_outline;
+	BlocksGeometry const& geometry = this->blocks_geometry;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::EVALUATE_AREA_OUTLINE);
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::evaluateAreaOutline(" << fitting_layouts_ratio << ")" << std::endl;
@@ -890,20 +2109,29 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 	dies_AR.reserve(this->IC.layers);
 	dies_area.reserve(this->IC.layers);
 
+	// outlines of dies are already determined during layout generation of
+	// parallel dies
+	if (this->dies_outline_avail) {
+		dies_outline_x = this->dies_outline_x;
+		dies_outline_y = this->dies_outline_y;
+	}
+	// determine outline for blocks on all dies separately, w/ one pass over the
+	// blocks' coordinates
+	else {
+		dies_outline_x.assign(this->IC.layers, 0.0);
+		dies_outline_y.assign(this->IC.layers, 0.0);
+		for (b = 0; b < geometry.size(); b++) {
+			dies_outline_x[geometry.layer[b]] = std::max(dies_outline_x[geometry.layer[b]], geometry.ur_x[b]);
+			dies_outline_y[geometry.layer[b]] = std::max(dies_outline_y[geometry.layer[b]], geometry.ur_y[b]);
+		}
+	}
+
 	layout_fits_in_fixed_outline = true;
 	// determine outline and area
 	for (i = 0; i < this->IC.layers; i++) {
 
-		// determine outline for blocks on all dies separately
-		max_outline_x = max_outline_y = 0.0;
-		for (Block const& block : this->blocks) {
-
-			if (block.layer == i) {
-				// update max outline coords
-				max_outline_x = std::max(max_outline_x, block.bb.ur.x);
-				max_outline_y = std::max(max_outline_y, block.bb.ur.y);
-			}
-		}
+		max_outline_x = dies_outline_x[i];
+		max_outline_y = dies_outline_y[i];
 
 		// area, represented by blocks' outline; normalized to die area
 		dies_area.push_back((max_outline_x * max_outline_y) / (this->IC.die_area));
@@ -955,13 +2183,15 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 
 void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<CorblivarAlignmentReq> const& alignments, bool const& set_max_cost) {
 	int i;
-	std::vector<Rect const*> blocks_to_consider;
+	unsigned n;
 	std::vector< std::vector<Clustering::Segments> > nets_segments;
-	Rect bb, prev_bb;
+	Rect bb;
 	double prev_TSVs;
 	double net_weight;
 	RoutingUtilization::UtilResult util;
-	TSV_Island* island;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::EVALUATE_INTERCONNECTS);
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::evaluateInterconnects(" << &cost << ", " << &alignments << ", " << set_max_cost << ")" << std::endl;
@@ -973,7 +2203,7 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 	cost.TSVs = cost.TSVs_actual_value = 0;
 	cost.TSVs_area_deadspace_ratio = 0.0;
 
-	// reset TSVs
+	// reset TSVs; capacity of the container is retained
 	this->TSVs.clear();
 
 	// reset TSVs also from nets
@@ -984,19 +2214,29 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 	// reset routing-utilization estimation
 	this->routingUtil.resetUtilMaps(this->IC.layers);
 
-	// allocate vector for blocks to be considered
-	blocks_to_consider.reserve(this->blocks.size());
 	// allocate vector for nets' segments
 	for (i = 0; i < this->IC.layers; i++) {
 		nets_segments.emplace_back(std::vector<Clustering::Segments>());
 	}
 
+	// incremental evaluation; re-determine the cached bounding boxes for nets
+	// affected by the most recent layout changes; this also sets the nets'
+	// layer boundaries
+	if (!FloorPlanner::SA_COST_INTERCONNECTS_TRIVIAL_HPWL) {
+		this->updateInterconnectsCache();
+	}
+
 	// determine HPWL and TSVs for each net
-	for (Net& cur_net : this->nets) {
+	for (n = 0; n < this->nets.size(); n++) {
+
+		Net& cur_net = this->nets[n];
 
 		// set layer boundaries, i.e., determine lowest and uppermost layer of
-		// net's blocks
-		cur_net.setLayerBoundaries();
+		// net's blocks; for the detailed estimate, this is already done along
+		// w/ the cache update
+		if (FloorPlanner::SA_COST_INTERCONNECTS_TRIVIAL_HPWL) {
+			this->netlist.bucketPins(n, cur_net, this->blocks);
+		}
 
 		// determine net weight, for routing-utilization estimation across
 		// multiple layers
@@ -1010,22 +2250,10 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 		// to compare w/ other 3D floorplanning tools
 		if (FloorPlanner::SA_COST_INTERCONNECTS_TRIVIAL_HPWL) {
 
-			// resets blocks to be considered for each cur_net
-			blocks_to_consider.clear();
-
-			// blocks for cur_net on all layer
-			for (Block const* b : cur_net.blocks) {
-				blocks_to_consider.push_back(&b->bb);
-			}
-
-			// also consider routes to terminal pins
-			for (Pin const* pin :  cur_net.terminals) {
-				blocks_to_consider.push_back(&pin->bb);
-			}
-
-			// determine HPWL of related blocks using their bounding box;
-			// consider center points of blocks instead their whole outline
-			bb = Rect::determBoundingBox(blocks_to_consider, true);
+			// determine HPWL of related blocks and terminal pins using their
+			// bounding box; consider center points of blocks instead their
+			// whole outline
+			bb = this->netlist.determCenterBoundingBox(n, cur_net, this->blocks);
 			cost.HPWL += bb.w;
 			cost.HPWL += bb.h;
 
@@ -1048,39 +2276,20 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 			}
 		}
 		// more detailed estimate; consider HPWL on each layer separately using
-		// layer-related bounding boxes
+		// layer-related bounding boxes, as cached
 		else {
-			// reset of prev_bb not required: for the next net, since we
-			// previously determine the respective lower layer, we guarantee
-			// that at least one block is in that lowermost layer, i.e., that
-			// a non-empty bb can be constructed
-
-			// determine HPWL on each related layer separately
-			for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
+			InterconnectsCache::NetEntry const& cached = this->interconnects_cache.nets[n];
 
-				// determine HPWL using the net's bounding box on the
-				// current layer
-				bb = cur_net.determBoundingBox(i);
-				cost.HPWL += bb.w;
-				cost.HPWL += bb.h;
+			// HPWL on all related layers
+			cost.HPWL += cached.HPWL;
 
-				if (Net::DBG) {
-					std::cout << "DBG_NET> 		HPWL of bounding box of blocks (in current and possibly upper layers) to consider: " << (bb.w + bb. h) << std::endl;
-				}
+			// handle each related layer separately
+			for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
 
-				// determBoundingBox may also return empty bounding boxes,
-				// namely for nets w/o blocks on the currently considered
-				// layer. Then, we need to consider the non-empty box from
-				// one of the layers below in order to provide a
-				// reasonable net's bb
-				if (bb.area == 0.0) {
-					bb = prev_bb;
-				}
-				// memorize current non-empty bb as previous bb for next
-				// iteration
-				else {
-					prev_bb = bb;
-				}
+				// the net's bounding box on the current layer; empty
+				// boxes are already replaced w/ the box of the layer
+				// below
+				bb = cached.bbs[i - cur_net.layer_bottom];
 
 				// for clustering; memorize bounding boxes for nets
 				// connecting further up (i.e., requiring a TSV)
@@ -1116,8 +2325,9 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 					//
 					if (i < cur_net.layer_top) {
 
-						// define new trivial island, with one TSV
-						island = new TSV_Island(
+						// define new trivial island, with one TSV;
+						// construct in global container
+						this->TSVs.emplace_back(
 								// net id and layer
 								"net_" + std::to_string(cur_net.id) + "_" + std::to_string(i),
 								// one TSV count
@@ -1134,9 +2344,6 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 
 						// here, greedy shifting is ignored for simplicity and runtime
 						//
-
-						// memorize TSV in global container
-						this->TSVs.push_back(*island);
 					}
 				}
 			}
@@ -1167,7 +2374,9 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 		cost.HPWL = 0.0;
 
 		// determine HPWL for each net
-		for (Net& cur_net : this->nets) {
+		for (n = 0; n < this->nets.size(); n++) {
+
+			Net const& cur_net = this->nets[n];
 
 			if (Net::DBG) {
 				std::cout << "DBG_NET> Determine HPWL (w/ consideration of TSV positions) for net " << cur_net.id << std::endl;
@@ -1177,7 +2386,7 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 			for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
 
 				// determine the net's bounding box on the current layer
-				bb = cur_net.determBoundingBox(i);
+				bb = this->netlist.determBoundingBox(n, cur_net, i, this->TSVs);
 
 				// add HPWL of bb to cost
 				cost.HPWL += bb.w;
@@ -1244,6 +2453,223 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, std::vector<C
 	}
 }
 
+// update cache of nets' per-layer bounding boxes; only nets w/ blocks which have been
+// moved, reshaped or assigned to another layer since the previous update are
+// re-determined; replaced entries are journaled for rollback
+void FloorPlanner::updateInterconnectsCache() {
+	InterconnectsCache& cache = this->interconnects_cache;
+	BlocksGeometry const& geometry = this->blocks_geometry;
+	unsigned b, n;
+	int i;
+	Rect bb, prev_bb;
+	bool moved;
+	unsigned dirty_nets;
+
+	// reset journal; only the most recent update can be rolled back
+	cache.journal_blocks.clear();
+	cache.journal_nets.clear();
+
+	// (re-)initialize cache; all nets have to be determined
+	if (!cache.valid) {
+
+		cache.blocks.assign(this->blocks.size(), InterconnectsCache::BlockEntry());
+		cache.nets.assign(this->nets.size(), InterconnectsCache::NetEntry());
+		cache.nets_dirty.assign(this->nets.size(), 1);
+
+		for (b = 0; b < geometry.size(); b++) {
+			cache.blocks[b].bb = geometry.bb(b);
+			cache.blocks[b].layer = geometry.layer[b];
+		}
+
+		cache.valid = true;
+	}
+	// determine blocks changed since previous update, flag their nets
+	else {
+		for (b = 0; b < geometry.size(); b++) {
+
+			InterconnectsCache::BlockEntry& cached = cache.blocks[b];
+
+			moved = (
+					geometry.layer[b] != cached.layer ||
+					geometry.ll_x[b] != cached.bb.ll.x ||
+					geometry.ll_y[b] != cached.bb.ll.y ||
+					geometry.ur_x[b] != cached.bb.ur.x ||
+					geometry.ur_y[b] != cached.bb.ur.y
+				);
+
+			if (moved) {
+
+				cache.journal_blocks.push_back({b, cached});
+
+				cached.bb = geometry.bb(b);
+				cached.layer = geometry.layer[b];
+
+				for (unsigned const& net : this->blocks_nets[b]) {
+					cache.nets_dirty[net] = 1;
+				}
+			}
+		}
+	}
+
+	// re-determine flagged nets; also (re-)set layer boundaries for all nets,
+	// since they may have been overwritten by an update which was rolled back
+	// in the meantime
+	dirty_nets = 0;
+	for (n = 0; n < this->nets.size(); n++) {
+
+		Net const& cur_net = this->nets[n];
+
+		if (!cache.nets_dirty[n]) {
+			cur_net.layer_bottom = cache.nets[n].layer_bottom;
+			cur_net.layer_top = cache.nets[n].layer_top;
+
+			// the net's pins are to be re-bucketed after rollbacks, since
+			// they relate to the reverted layout; note that the layer
+			// boundaries are equal to the cached ones
+			if (this->netlist.isOutdated(n)) {
+				this->netlist.bucketPins(n, cur_net, this->blocks);
+			}
+
+			continue;
+		}
+
+		cache.nets_dirty[n] = 0;
+		dirty_nets++;
+
+		// journal previous entry; note that entry is moved and thus to be
+		// rebuild from scratch
+		cache.journal_nets.push_back({n, std::move(cache.nets[n])});
+		InterconnectsCache::NetEntry& cached = cache.nets[n];
+
+		// bucket net's pins by layer; this also sets layer boundaries, i.e.,
+		// determines lowest and uppermost layer of net's blocks
+		this->netlist.bucketPins(n, cur_net, this->blocks);
+		cached.layer_bottom = cur_net.layer_bottom;
+		cached.layer_top = cur_net.layer_top;
+
+		cached.HPWL = 0.0;
+		cached.bbs.clear();
+
+		// reset prev_bb; for nets w/o any bounding box on their lowermost layer,
+		// i.e., nets comprising only one block, the empty box is considered
+		prev_bb = Rect();
+
+		// determine HPWL on each related layer separately
+		for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
+
+			// determine HPWL using the net's bounding box on the current
+			// layer
+			bb = this->netlist.determBoundingBox(n, cur_net, i, this->TSVs);
+			cached.HPWL += bb.w;
+			cached.HPWL += bb.h;
+
+			if (Net::DBG) {
+				std::cout << "DBG_NET> 		HPWL of bounding box of blocks (in current and possibly upper layers) to consider: " << (bb.w + bb. h) << std::endl;
+			}
+
+			// determBoundingBox may also return empty bounding boxes, namely
+			// for nets w/o blocks on the currently considered layer. Then, we
+			// need to consider the non-empty box from one of the layers below
+			// in order to provide a reasonable net's bb
+			if (bb.area == 0.0) {
+				bb = prev_bb;
+			}
+			// memorize current non-empty bb as previous bb for next
+			// iteration
+			else {
+				prev_bb = bb;
+			}
+
+			cached.bbs.push_back(bb);
+		}
+	}
+
+	if (FloorPlanner::DBG_INTERCONNECTS_CACHE) {
+
+		std::cout << "DBG_INTERCONNECTS_CACHE> Moved blocks: " << cache.journal_blocks.size() << "; re-determined nets: " << dirty_nets << "/" << this->nets.size() << std::endl;
+
+		// sanity check; compare cached HPWL to HPWL from scratch, using the
+		// reference implementation of Net
+		for (n = 0; n < this->nets.size(); n++) {
+
+			bb = Rect();
+			for (i = this->nets[n].layer_bottom; i <= this->nets[n].layer_top; i++) {
+				bb.w += this->nets[n].determBoundingBox(i, this->TSVs).w;
+				bb.h += this->nets[n].determBoundingBox(i, this->TSVs).h;
+			}
+
+			if (!Math::doubleComp(bb.w + bb.h, cache.nets[n].HPWL)) {
+				std::cout << "DBG_INTERCONNECTS_CACHE> Cached HPWL for net " << this->nets[n].id << " is outdated; cached: " << cache.nets[n].HPWL;
+				std::cout << ", actual: " << bb.w + bb.h << std::endl;
+			}
+		}
+	}
+}
+
+// rollback most recent update of interconnects cache; required for reverted layout
+// operations, in order to keep the cache in sync w/ the (restored) previous layout
+void FloorPlanner::rollbackInterconnectsCache() {
+	InterconnectsCache& cache = this->interconnects_cache;
+
+	if (!cache.valid) {
+		return;
+	}
+
+	for (auto& entry : cache.journal_blocks) {
+		cache.blocks[entry.first] = entry.second;
+	}
+	for (auto& entry : cache.journal_nets) {
+		cache.nets[entry.first] = std::move(entry.second);
+
+		// the net's pins are bucketed according to the reverted layout
+		this->netlist.invalidate(entry.first);
+	}
+
+	cache.journal_blocks.clear();
+	cache.journal_nets.clear();
+}
+
+bool FloorPlanner::lookupEvaluationCache(unsigned long long const& key, Cost& cost) {
+	EvaluationCache& cache = this->evaluation_cache;
+	std::unordered_map<unsigned long long, std::list<EvaluationCache::Entry>::iterator>::iterator it;
+
+	it = cache.index.find(key);
+	if (it == cache.index.end()) {
+		return false;
+	}
+
+	// memorize as most recently used entry
+	cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+
+	cost = it->second->cost;
+
+	return true;
+}
+
+void FloorPlanner::insertEvaluationCache(unsigned long long const& key, Cost const& cost, double const& time) {
+	EvaluationCache& cache = this->evaluation_cache;
+	std::unordered_map<unsigned long long, std::list<EvaluationCache::Entry>::iterator>::iterator it;
+
+	// replace previous entry, e.g., a cached lower bound
+	it = cache.index.find(key);
+	if (it != cache.index.end()) {
+		cache.entries.erase(it->second);
+		cache.index.erase(it);
+	}
+	// drop least-recently used entry; its list node is reused for the new entry
+	else if (cache.entries.size() == FloorPlanner::SA_EVALUATION_CACHE_CAPACITY) {
+		cache.index.erase(cache.entries.back().key);
+		cache.entries.splice(cache.entries.begin(), cache.entries, std::prev(cache.entries.end()));
+		cache.entries.front() = {key, cost, time};
+		cache.index[key] = cache.entries.begin();
+
+		return;
+	}
+
+	cache.entries.push_front({key, cost, time});
+	cache.index[key] = cache.entries.begin();
+}
+
 // costs are derived from spatial mismatch b/w blocks' alignment and intended alignment;
 // note that this function also marks requests as failed or successful
 void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignmentReq> const& alignments, bool const& derive_TSVs, bool const& set_max_cost, bool const& finalize) {
@@ -1252,9 +2678,13 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 	int layer, min_layer, max_layer;
 	CorblivarAlignmentReq::Evaluate eval;
 	TSV_Island* island;
+	unsigned t;
 	bool shift;
 	RoutingUtilization::UtilResult util;
 
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::EVALUATE_ALIGNMENTS);
+
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::evaluateAlignments(" << &cost << ", " << &alignments << ", " << derive_TSVs << ", " << set_max_cost << ", " << finalize << ")" << std::endl;
 	}
@@ -1302,7 +2732,7 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 				// however, block alignments with respect to RBOD (since
 				// RBOD layer is -1 and RBOD.bb is zero, they will be
 				// triggered here) should be ignored as well
-				if (req.s_i->id != RBOD::ID && req.s_j->id != RBOD::ID) {
+				if (req.s_i->numerical_id != RBOD::NUMERICAL_ID && req.s_j->numerical_id != RBOD::NUMERICAL_ID) {
 
 					// here, we consider the blocks' bounding box for
 					// guiding placement of the required TSV island
@@ -1320,10 +2750,13 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 
 				for (layer = min_layer; layer < max_layer; layer++) {
 
-					// define new island
-					island = new TSV_Island(
-							// bus id
-							"bus_" + req.s_i->id + "_" + req.s_j->id,
+					// define new island; construct in global container
+					this->TSVs.emplace_back(
+							// bus id; not required during
+							// optimization, the string is derived
+							// from the alignment request only for
+							// output
+							"",
 							// signal / TSV count
 							req.signals,
 							// TSV pitch; required for proper scaling
@@ -1338,8 +2771,13 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 							// for vertical buses, provide
 							// specific width according to
 							// alignment requirement
-							req.vertical_bus() ? req.alignment_x : -1.0
+							req.vertical_bus() ? req.alignment_x : -1.0,
+							// related alignment request
+							req.id
 						);
+					// note that the pointer is valid until the next
+					// island is constructed
+					island = &this->TSVs.back();
 
 					// perform greedy shifting in case new island
 					// overlaps with any previous one
@@ -1349,7 +2787,10 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 
 						shift = false;
 
-						for (TSV_Island const& prev_island : this->TSVs) {
+						// previous islands, i.e., all but the new one
+						for (t = 0; t < this->TSVs.size() - 1; t++) {
+
+							TSV_Island& prev_island = this->TSVs[t];
 
 							if (prev_island.layer != island->layer) {
 								continue;
@@ -1363,9 +2804,6 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 						}
 					}
 
-					// memorize TSV in global container
-					this->TSVs.push_back(*island);
-
 					// determine the HPWL components and routing
 					// utilization; net segments are to be considered
 					// for routing b/w the block and TSV island on the
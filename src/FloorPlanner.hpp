@@ -27,11 +27,17 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Block.hpp"
+#include "BlocksGeometry.hpp"
 #include "Net.hpp"
+#include "Netlist.hpp"
+#include "BenchmarkCache.hpp"
 #include "ThermalAnalyzer.hpp"
+#include "ThermalSolver.hpp"
 #include "LayoutOperations.hpp"
 #include "Clustering.hpp"
 #include "RoutingUtilization.hpp"
+#include "ThreadPool.hpp"
+#include "Telemetry.hpp"
 // forward declarations, if any
 class CorblivarCore;
 class CorblivarAlignmentReq;
@@ -43,6 +49,8 @@ class FloorPlanner {
 		static constexpr bool DBG_CALLS_SA = false;
 		static constexpr bool DBG_LAYOUT = false;
 		static constexpr bool DBG_TSVS = false;
+		static constexpr bool DBG_INTERCONNECTS_CACHE = false;
+		static constexpr bool DBG_EVALUATION_CACHE = false;
 
 	// private data, functions
 	private:
@@ -51,9 +59,34 @@ class FloorPlanner {
 		std::vector<Pin> terminals;
 		std::vector<Net> nets;
 
-		// groups of TSVs, will be defined from nets and vertical buses
+		// hash indices of blocks' and terminal pins' names to their numerical
+		// ids, i.e., their indices in the above containers; derived in
+		// IO::parseBlocks
+		std::unordered_map<std::string, unsigned> blocks_index, terminals_index;
+
+		// snapshot of blocks' geometry as struct of arrays; copied from the
+		// blocks for each layout evaluation, see evaluateLayout
+		BlocksGeometry blocks_geometry;
+
+		// groups of TSVs, will be defined from nets and vertical buses; the
+		// container serves as arena for the TSV islands of one layout
+		// evaluation, i.e., islands are constructed in place, and the container
+		// is reset (w/o releasing its memory) for each evaluation; nets refer to
+		// islands via their indices
 		std::vector<TSV_Island> TSVs;
 
+		// nets of each block, i.e., blocks_nets[i] lists the indices of all nets
+		// connected to blocks[i]; derived along w/ nets in IO::parseNets
+		std::vector< std::vector<unsigned> > blocks_nets;
+
+		// compact representation of nets, w/ pins bucketed by layer; derived
+		// along w/ nets in IO::parseNets
+		Netlist netlist;
+
+		// records of benchmark files, parsed or loaded from cache file; only
+		// held during parsing
+		BenchmarkCache benchmark_cache;
+
 		// dummy reference block, represents lower-left corner of dies
 		RBOD const RBOD;
 
@@ -88,6 +121,8 @@ class FloorPlanner {
 		// IO files and parameters
 		struct IO_conf {
 			std::string blocks_file, alignments_file, pins_file, power_density_file, nets_file, solution_file;
+			// binary cache for pre-parsed benchmark files
+			std::string benchmark_cache_file;
 			std::ofstream results, solution_out;
 			std::ifstream solution_in;
 			// flag whether power density file is available / was handled /
@@ -105,6 +140,27 @@ class FloorPlanner {
 		// as command-line parameter
 		bool thermal_analyser_run;
 
+		// run mode; count of independent SA replicas, to be run concurrently
+		// on a thread pool; only the best solution across all replicas is kept
+		unsigned replicas;
+
+		// run mode; the replicas are run as parallel tempering, i.e., w/ replica
+		// exchange along a fixed temperature ladder
+		bool parallel_tempering;
+
+		// run mode; layout generation, packing and outline evaluation are
+		// performed concurrently for all dies; only applicable w/o alignment,
+		// where the dies are independent of each other
+		bool parallel_dies;
+
+		// run mode; streaming of SA telemetry, i.e., one JSON line for each
+		// temperature step; only if desired, otherwise nullptr; shared w/ the
+		// first SA replica
+		std::shared_ptr<Telemetry> telemetry;
+
+		// run mode; fitting of power-blurring parameters for given solution
+		bool thermal_fitting;
+
 		// time logging
 		struct timeb time_start;
 
@@ -146,26 +202,31 @@ class FloorPlanner {
 		static constexpr double SA_COST_WEIGHT_AREA_OUTLINE = 0.5;
 		static constexpr double SA_COST_WEIGHT_OTHERS = 1.0 - SA_COST_WEIGHT_AREA_OUTLINE;
 
-		// SA cost; POD declaration
+		// SA cost; all terms are initialized as zero, since not all of them are
+		// evaluated in every SA phase
 		struct Cost {
-			double total_cost;
-			double total_cost_fitting;
-			double HPWL;
-			double HPWL_actual_value;
-			double routing_util;
-			double routing_util_actual_value;
+			double total_cost = 0.0;
+			double total_cost_fitting = 0.0;
+			double HPWL = 0.0;
+			double HPWL_actual_value = 0.0;
+			double routing_util = 0.0;
+			double routing_util_actual_value = 0.0;
 			// requires double since it contains normalized values
-			double TSVs;
-			int TSVs_actual_value;
-			double TSVs_area_deadspace_ratio;
-			double alignments;
-			double alignments_actual_value;
-			double thermal;
-			double thermal_actual_value;
-			double area_outline;
-			double area_actual_value;
-			double outline_actual_value;
-			bool fits_fixed_outline;
+			double TSVs = 0.0;
+			int TSVs_actual_value = 0;
+			double TSVs_area_deadspace_ratio = 0.0;
+			double alignments = 0.0;
+			double alignments_actual_value = 0.0;
+			double thermal = 0.0;
+			double thermal_actual_value = 0.0;
+			double area_outline = 0.0;
+			double area_actual_value = 0.0;
+			double outline_actual_value = 0.0;
+			bool fits_fixed_outline = false;
+			// staged evaluation has been aborted since a lower bound of the
+			// total cost exceeds the given ceiling; the cost terms are then
+			// incomplete and total_cost refers to the lower bound
+			bool exceeds_ceiling = false;
 
 			// http://www.learncpp.com/cpp-tutorial/93-overloading-the-io-operators/
 			friend std::ostream& operator<< (std::ostream& out, Cost const& cost) {
@@ -174,14 +235,19 @@ class FloorPlanner {
 			}
 		};
 
-		// SA: cost functions, i.e., layout-evaluations
+		// SA: cost functions, i.e., layout-evaluations; in SA phase two, the
+		// cost terms are evaluated in stages, and the evaluation is aborted once
+		// the cost determined so far exceeds the cost ceiling
 		Cost evaluateLayout(std::vector<CorblivarAlignmentReq> const& alignments,
 				double const& fitting_layouts_ratio = 0.0,
 				bool const& SA_phase_two = false,
 				bool const& set_max_cost = false,
-				bool const& finalize = false);
+				bool const& finalize = false,
+				double const& cost_ceiling = std::numeric_limits<double>::infinity());
 		void evaluateThermalDistr(Cost& cost,
-				bool const& set_max_cost = false);
+				bool const& set_max_cost = false,
+				bool const& incremental = true);
+		void evaluateSteadyStateTemp();
 		void evaluateAlignments(Cost& cost,
 				std::vector<CorblivarAlignmentReq> const& alignments,
 				bool const& derive_TSVs = true,
@@ -194,6 +260,83 @@ class FloorPlanner {
 				std::vector<CorblivarAlignmentReq> const& alignments,
 				bool const& set_max_cost = false);
 
+		// SA: incremental evaluation of interconnects; the nets' per-layer
+		// bounding boxes are cached and only re-determined for nets whose
+		// blocks have been moved, reshaped or assigned to another layer
+		struct InterconnectsCache {
+
+			// POD for cached net data
+			struct NetEntry {
+				int layer_bottom, layer_top;
+				// HPWL of all per-layer bounding boxes
+				double HPWL;
+				// bounding boxes for layers layer_bottom to layer_top; empty
+				// boxes are already replaced w/ the box of the layer below
+				std::vector<Rect> bbs;
+			};
+			// POD for snapshot of block data
+			struct BlockEntry {
+				Rect bb;
+				int layer;
+			};
+
+			bool valid;
+
+			// snapshot of the blocks' geometry and layers which the cached net
+			// entries are based on
+			std::vector<BlockEntry> blocks;
+			std::vector<NetEntry> nets;
+
+			// helper, flags for nets to be re-determined
+			std::vector<int> nets_dirty;
+
+			// journal of replaced entries during most recent update, required
+			// for rollback of reverted layout operations
+			std::vector< std::pair<unsigned, BlockEntry> > journal_blocks;
+			std::vector< std::pair<unsigned, NetEntry> > journal_nets;
+		} interconnects_cache;
+
+		void updateInterconnectsCache();
+		void rollbackInterconnectsCache();
+		inline void invalidateInterconnectsCache() {
+			this->interconnects_cache.valid = false;
+		};
+		// the most recent update is not to be rolled back, e.g., since the
+		// related layout has been accepted
+		inline void commitInterconnectsCache() {
+			this->interconnects_cache.journal_blocks.clear();
+			this->interconnects_cache.journal_nets.clear();
+		};
+
+		// SA: cache for layout evaluations; maps the layout hash, combined w/
+		// the evaluation context, to the cost of the layout; w/ bounded
+		// capacity, the least-recently used entries are dropped
+		struct EvaluationCache {
+
+			// POD for cached evaluation
+			struct Entry {
+				unsigned long long key;
+				Cost cost;
+				// time of layout generation and evaluation, in ns
+				double time;
+			};
+
+			// entries, ordered by their most recent use
+			std::list<Entry> entries;
+			std::unordered_map<unsigned long long, std::list<Entry>::iterator> index;
+		} evaluation_cache;
+
+		static constexpr unsigned SA_EVALUATION_CACHE_CAPACITY = 4096;
+
+		bool lookupEvaluationCache(unsigned long long const& key, Cost& cost);
+		void insertEvaluationCache(unsigned long long const& key, Cost const& cost, double const& time);
+		// cached costs are only valid for the cost normalization and the die
+		// outline they were determined with
+		inline void clearEvaluationCache() {
+			this->evaluation_cache.entries.clear();
+			this->evaluation_cache.index.clear();
+		};
+
 		// SA: parameters for cost functions
 		//
 		// trivial HPWL refers to one global bounding box for each net;
@@ -219,6 +362,27 @@ class FloorPlanner {
 		// SA: temperature-schedule log data
 		std::vector<TempStep> tempSchedule;
 
+		// SA-related state of one annealing chain; POD declaration
+		struct SAChain {
+			// state maintained across temperature steps
+			double cur_temp;
+			TempPhase cooling_phase;
+			bool SA_phase_two;
+			double fitting_layouts_ratio;
+			double best_cost;
+			bool valid_layout_found;
+			int i_valid_layout_found;
+			// cost terms of the current, i.e., most recently accepted layout
+			Cost accepted_cost;
+
+			// state of the most recent temperature step
+			int ops;
+			int accepted_ops;
+			int layout_fit_counter;
+			double avg_cost;
+			bool best_sol_found;
+		};
+
 		// SA: reheating parameters, for SA phase 3
 		static constexpr int SA_REHEAT_COST_SAMPLES = 3;
 		static constexpr double SA_REHEAT_STD_DEV_COST_LIMIT = 1.0e-3;
@@ -226,6 +390,17 @@ class FloorPlanner {
 		// layout-generation handler
 		bool generateLayout(CorblivarCore& corb, bool const& perform_alignment = false);
 
+		// layout-generation handler for parallel dies; the dies are handled on
+		// persistent worker threads, initialized on first run
+		std::unique_ptr<ThreadPool> dies_pool;
+		bool generateLayoutParallelDies(CorblivarCore& corb);
+
+		// outlines of the dies, determined along w/ layout generation of
+		// parallel dies; reset by any other layout generation, then the outlines
+		// are determined in evaluateAreaOutline
+		std::vector<double> dies_outline_x, dies_outline_y;
+		bool dies_outline_avail;
+
 		// layout-operation handler
 		LayoutOperations layoutOp;
 
@@ -248,6 +423,38 @@ class FloorPlanner {
 		// note that various parameters are return-by-reference
 		void initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp);
 		TempPhase updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const;
+		void initSAChain(SAChain& chain, double const& init_temp, std::vector<double> const& cost_samples) const;
+		void performSAStep(CorblivarCore& corb, SAChain& chain, int const& innerLoopMax, int const& iteration);
+		void streamTelemetry(int const& iteration, SAChain const& chain, double const& best_cost, bool const& best_sol_found, double const& ops_per_sec) const;
+
+		// SA: parallel tempering; the temperature ladder starts at the initial
+		// temperature, as determined by initSA; the further rungs are spaced
+		// such that exchanges of neighboring rungs for a cost difference of
+		// one std dev of the sampled costs are accepted w/ this probability
+		static constexpr double SA_PT_EXCHANGE_ACCEPTANCE = 0.3;
+
+		// thermal fitting: Nelder-Mead simplex search for power-blurring
+		// parameters; limit for evaluations, restarts from best vertex, and
+		// relative tolerance for spread of errors w/in the simplex
+		static constexpr unsigned THERMAL_FITTING_EVALUATIONS = 5000;
+		static constexpr unsigned THERMAL_FITTING_RESTARTS = 3;
+		static constexpr double THERMAL_FITTING_TOLERANCE = 1.0e-6;
+		// thermal fitting: initial simplex, relative step for parameters
+		static constexpr double THERMAL_FITTING_INIT_STEP = 0.25;
+
+		// SA: helper for replicas; adopt the cost normalization of another
+		// floorplanner
+		inline void adoptMaxCost(FloorPlanner const& fp) {
+			this->max_cost_thermal = fp.max_cost_thermal;
+			this->max_cost_WL = fp.max_cost_WL;
+			this->max_cost_alignments = fp.max_cost_alignments;
+			this->max_cost_routing_util = fp.max_cost_routing_util;
+			this->max_cost_TSVs = fp.max_cost_TSVs;
+		};
+
+		// SA replicas: derive independent replica from parsed master
+		// floorplanner; layout state is cloned, terminals are shared
+		void initReplica(FloorPlanner const& master, CorblivarCore const& master_corb, CorblivarCore& corb, unsigned const& replica);
 
 		// thermal analyzer
 		ThermalAnalyzer thermalAnalyzer;
@@ -258,6 +465,17 @@ class FloorPlanner {
 		// thermal analyzer; current results of thermal analysis
 		ThermalAnalyzer::ThermalAnalysisResult thermal_analysis;
 
+		// count of thermal analyses performed; identifies the thermal map and the
+		// incremental state of the thermal analyzer, i.e., the data of previous
+		// evaluations which the hotspots, the TSV clustering and the next
+		// thermal analysis depend on
+		unsigned long thermal_analyses;
+
+		// steady-state thermal solver, parameters and results
+		ThermalSolver thermalSolver;
+		ThermalSolver::Parameters thermal_solver_parameters;
+		ThermalSolver::SteadyStateResult thermal_solver_result;
+
 		// clustering handler
 		Clustering clustering;
 
@@ -271,7 +489,16 @@ class FloorPlanner {
 			ftime(&(this->time_start));
 
 			// init random number generator
-			srand(time(0));
+			Math::initRandomNumberGenerator(time(0));
+
+			// incremental evaluation of interconnects requires initial, full
+			// evaluation
+			this->invalidateInterconnectsCache();
+
+			// outlines of dies are not available yet
+			this->dies_outline_avail = false;
+
+			this->thermal_analyses = 0;
 		}
 
 	// public data, functions
@@ -356,6 +583,12 @@ class FloorPlanner {
 
 			// rescale terminal pins' locations
 			this->scaleTerminalPins();
+
+			// cached interconnects depend on terminal pins' locations
+			this->invalidateInterconnectsCache();
+
+			// cached evaluations depend on die outline
+			this->clearEvaluationCache();
 		}
 
 		inline void scaleTerminalPins() {
@@ -380,13 +613,32 @@ class FloorPlanner {
 			}
 		}
 
+		inline unsigned const& getReplicas() const {
+			return this->replicas;
+		};
+
+		inline bool const& parallelTempering() const {
+			return this->parallel_tempering;
+		};
+
 		inline bool inputSolutionFileOpen() const {
 			return this->IO_conf.solution_in.is_open();
 		};
 
+		inline bool const& thermalFitting() const {
+			return this->thermal_fitting;
+		};
+
 		// SA: handler
 		bool performSA(CorblivarCore& corb);
+		// SA: handler for multiple, concurrently running replicas
+		bool performSAReplicas(CorblivarCore& corb);
+		// SA: handler for parallel tempering, i.e., replica exchange
+		bool performParallelTempering(CorblivarCore& corb);
 		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true);
+
+		// fitting of power-blurring parameters for given solution
+		void fitThermalParameters(CorblivarCore& corb);
 };
 
 #endif
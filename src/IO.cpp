@@ -33,9 +33,14 @@
 #include "Math.hpp"
 #include "Clustering.hpp"
 #include "Block.hpp"
+#include "TokenStream.hpp"
+#include "BenchmarkCache.hpp"
+#include "PhaseTimers.hpp"
 
 // parse program parameter, config file, and further files
-void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
+void IO::parseParametersFiles(FloorPlanner& fp, int const& argc_all, char** argv_all) {
+	int argc;
+	std::vector<char*> argv;
 	int file_version;
 	size_t last_slash;
 	std::ifstream in;
@@ -46,18 +51,76 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	std::stringstream pins_file;
 	std::stringstream power_density_file;
 	std::stringstream nets_file;
+	std::stringstream benchmark_cache_file;
 	std::string tmpstr;
 	ThermalAnalyzer::MaskParameters mask_parameters;
+	int map_dim;
+
+	// separate optional flags, i.e., parameters prefixed by ``--'', from the
+	// regular parameters
+	fp.replicas = 1;
+	fp.parallel_tempering = false;
+	fp.parallel_dies = false;
+	fp.thermal_fitting = false;
+	for (int i = 0; i < argc_all; i++) {
+
+		tmpstr = argv_all[i];
+
+		if (tmpstr == "--replicas") {
+
+			if (i + 1 >= argc_all || atoi(argv_all[i + 1]) < 1) {
+				std::cout << "IO> Provide a positive, non-zero count of SA replicas for ``--replicas''!" << std::endl;
+				exit(1);
+			}
+
+			fp.replicas = atoi(argv_all[++i]);
+		}
+		else if (tmpstr == "--parallel-tempering") {
+
+			if (i + 1 >= argc_all || atoi(argv_all[i + 1]) < 2) {
+				std::cout << "IO> Provide at least two replicas for ``--parallel-tempering''!" << std::endl;
+				exit(1);
+			}
+
+			fp.replicas = atoi(argv_all[++i]);
+			fp.parallel_tempering = true;
+		}
+		else if (tmpstr == "--parallel-dies") {
+			fp.parallel_dies = true;
+		}
+		else if (tmpstr == "--telemetry") {
+
+			if (i + 1 >= argc_all) {
+				std::cout << "IO> Provide a file or FIFO for ``--telemetry''!" << std::endl;
+				exit(1);
+			}
+
+			fp.telemetry = std::make_shared<Telemetry>(argv_all[++i]);
+		}
+		else if (tmpstr == "--fit-thermal") {
+			fp.thermal_fitting = true;
+		}
+		else {
+			argv.push_back(argv_all[i]);
+		}
+	}
+	argc = argv.size();
+	tmpstr = "";
 
 	// print command-line parameters
 	if (argc < 4) {
-		std::cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density]" << std::endl;
+		std::cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density] [--replicas N | --parallel-tempering K] [--parallel-dies] [--telemetry FILE] [--fit-thermal]" << std::endl;
 		std::cout << "IO> " << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmark_name'': any name, should refer to GSRC-Bookshelf benchmark" << std::endl;
 		std::cout << "IO> Mandatory parameter ``config_file'' format: see provided Corblivar.conf" << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmarks_dir'': folder containing actual benchmark files in GSRC Bookshelf format" << std::endl;
 		std::cout << "IO> Optional parameter ``solution_file'': re-evaluate w/ given Corblivar solution" << std::endl;
 		std::cout << "IO> Optional parameter ``TSV density'': average TSV density to be considered across all dies, to be given in \%" << std::endl;
+		std::cout << "IO> Optional flag ``--replicas N'': run N independent SA replicas concurrently, keep the best solution" << std::endl;
+		std::cout << "IO> Optional flag ``--parallel-tempering K'': run K SA replicas concurrently as parallel tempering, i.e., w/ replica exchange" << std::endl;
+		std::cout << "IO> Optional flag ``--parallel-dies'': generate, pack and evaluate the outline of all dies concurrently; only applicable w/o alignment" << std::endl;
+		std::cout << "IO> Optional flag ``--telemetry FILE'': stream SA telemetry, one JSON line for each temperature step, into file or FIFO; written asynchronously" << std::endl;
+		std::cout << "IO> Optional flag ``--fit-thermal'': fit power-blurring parameters for given solution file, against HotSpot thermal map (benchmark_name_HotSpot.steady.grid.layer_1) if available, otherwise against thermal solver" << std::endl;
 
 		exit(1);
 	}
@@ -91,6 +154,9 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	nets_file << argv[3] << fp.benchmark << ".nets";
 	fp.IO_conf.nets_file = nets_file.str();
 
+	benchmark_cache_file << argv[3] << fp.benchmark << ".corbcache";
+	fp.IO_conf.benchmark_cache_file = benchmark_cache_file.str();
+
 	results_file << fp.benchmark << ".results";
 	fp.IO_conf.results.open(results_file.str().c_str());
 
@@ -205,6 +271,17 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		mask_parameters.TSV_density = 0.0;
 	}
 
+	// fitting of power-blurring parameters requires given solution and power
+	// densities
+	if (fp.thermal_fitting && !fp.IO_conf.solution_in.is_open()) {
+		std::cout << "IO> Provide a solution file for ``--fit-thermal''!" << std::endl;
+		exit(1);
+	}
+	if (fp.thermal_fitting && !fp.IO_conf.power_density_file_avail) {
+		std::cout << "IO> Provide a power density file for ``--fit-thermal''!" << std::endl;
+		exit(1);
+	}
+
 	// config file parsing
 	//
 	in.open(config_file.c_str());
@@ -455,6 +532,51 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	// store power-blurring parameters
 	fp.power_blurring_parameters = mask_parameters;
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> map_dim;
+
+	// sanity check for thermal-map dimension; the map should be at least as large
+	// as the thermal masks
+	if (map_dim < ThermalAnalyzer::THERMAL_MASK_DIM) {
+		std::cout << "IO> Provide a thermal-map dimension of at least " << ThermalAnalyzer::THERMAL_MASK_DIM << "!" << std::endl;
+		exit(1);
+	}
+
+	fp.thermalAnalyzer.setThermalMapDim(map_dim);
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> map_dim;
+
+	// sanity check for routing-utilization map dimension
+	if (map_dim < 1) {
+		std::cout << "IO> Provide a positive, non-zero routing-utilization map dimension!" << std::endl;
+		exit(1);
+	}
+
+	fp.routingUtil.setUtilMapsDim(map_dim);
+
+	// thermal-solver parameters
+	//
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.thermal_solver_parameters.final_solution;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.thermal_solver_parameters.SA_steps_interval;
+
+	// sanity check for interval
+	if (fp.thermal_solver_parameters.SA_steps_interval < 0) {
+		std::cout << "IO> Provide a positive interval of SA temperature steps for the thermal solver, or 0 for no solver runs during optimization!" << std::endl;
+		exit(1);
+	}
+
 	in.close();
 
 	// technology file parsing
@@ -579,6 +701,13 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 	in.close();
 
+	// memorize technology parameters for thermal solver
+	fp.thermal_solver_parameters.Si_active_thickness = fp.IC.Si_active_thickness;
+	fp.thermal_solver_parameters.Si_passive_thickness = fp.IC.Si_passive_thickness;
+	fp.thermal_solver_parameters.BEOL_thickness = fp.IC.BEOL_thickness;
+	fp.thermal_solver_parameters.bond_thickness = fp.IC.bond_thickness;
+	fp.thermal_solver_parameters.TSV_group_Cu_area_ratio = fp.IC.TSV_group_Cu_area_ratio;
+
 	if (fp.logMin()) {
 		std::cout << "IO> Done; technology and config values:" << std::endl;
 
@@ -614,6 +743,10 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		// SA loop setup
 		std::cout << "IO>  SA -- Inner-loop operation-factor a (ops = N^a for N blocks): " << fp.schedule.loop_factor << std::endl;
 		std::cout << "IO>  SA -- Outer-loop upper limit: " << fp.schedule.loop_limit << std::endl;
+		std::cout << "IO>  SA -- Replicas (run concurrently): " << fp.replicas << std::endl;
+		std::cout << "IO>  SA -- Replicas run as parallel tempering: " << fp.parallel_tempering << std::endl;
+		std::cout << "IO>  SA -- Layout generation for parallel dies: " << fp.parallel_dies << std::endl;
+		std::cout << "IO>  SA -- Telemetry stream: " << (fp.telemetry ? fp.telemetry->getSink() : "none") << std::endl;
 
 		// SA cooling schedule
 		std::cout << "IO>  SA -- Start temperature scaling factor: " << fp.schedule.temp_init_factor << std::endl;
@@ -644,6 +777,14 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		std::cout << "IO>  Power-blurring mask parameterization -- Power-density down-scaling factor (TSV regions): " << mask_parameters.power_density_scaling_TSV_region << std::endl;
 		std::cout << "IO>  Power-blurring mask parameterization -- Temperature offset: " << mask_parameters.temp_offset << std::endl;
 
+		// map dimensions
+		std::cout << "IO>  Thermal-map dimension: " << fp.thermalAnalyzer.getThermalMapDim() << std::endl;
+		std::cout << "IO>  Routing-utilization map dimension: " << fp.routingUtil.getUtilMapsDim() << std::endl;
+
+		// thermal-solver parameters
+		std::cout << "IO>  Thermal solver -- Steady-state temperatures for final solution: " << fp.thermal_solver_parameters.final_solution << std::endl;
+		std::cout << "IO>  Thermal solver -- Interval of SA temperature steps for monitoring runs: " << fp.thermal_solver_parameters.SA_steps_interval << std::endl;
+
 		std::cout << std::endl;
 	}
 }
@@ -695,7 +836,7 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 			// block id
 			fp.IO_conf.solution_in >> block_id;
 			// find related block
-			tuple.S = Block::findBlock(block_id, fp.blocks);
+			tuple.S = Block::findBlock(block_id, fp.blocks, fp.blocks_index);
 			if (tuple.S == nullptr) {
 				std::cout << "IO> Block " << block_id << " cannot be retrieved; ensure solution file and benchmark file match!" << std::endl;
 				exit(1);
@@ -744,28 +885,74 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 		exit(1);
 	}
 
+	// parsed CBLs; init hash
+	corb.rehashLayout();
+
 	if (fp.logMed()) {
 		std::cout << "IO> ";
 		std::cout << "Done; parsed " << tuples << " tuples" << std::endl << std::endl;
 	}
 }
 
+// parse HotSpot steady-state thermal map of lowest active Si layer, as generated by
+// HotSpot.sh; returns false if not available
+bool IO::parseHotSpotThermalMap(FloorPlanner const& fp, std::vector< std::vector<double> >& thermal_map) {
+	std::ifstream in;
+	std::stringstream file;
+	int dim;
+	int bins;
+	int index;
+	double temp;
+
+	// layer 1 relates to the active Si layer of the lowest die, see
+	// writeHotSpotFiles
+	file << fp.benchmark << "_HotSpot.steady.grid.layer_1";
+
+	in.open(file.str().c_str());
+	if (!in.good()) {
+		return false;
+	}
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Parsing HotSpot thermal map " << file.str() << " ..." << std::endl;
+	}
+
+	dim = fp.thermalAnalyzer.getThermalMapDim();
+
+	thermal_map.assign(dim, std::vector<double>(dim, 0.0));
+
+	// HotSpot grid: row-major order of bins, w/ first row as uppermost row; i.e.,
+	// the row relates to the inverted y-dimension, the column to the
+	// x-dimension
+	bins = 0;
+	while (in >> index >> temp) {
+
+		// sanity check for grid dimensions
+		if (index < 0 || index >= dim * dim) {
+			std::cout << "IO> Parsing error: HotSpot thermal map does not match the thermal-map dimension " << dim << "!" << std::endl;
+			exit(1);
+		}
+
+		thermal_map[index % dim][dim - 1 - index / dim] = temp;
+		bins++;
+	}
+
+	// sanity check for grid dimensions
+	if (bins != dim * dim) {
+		std::cout << "IO> Parsing error: HotSpot thermal map contains " << bins << " bins; the thermal map requires " << dim * dim << " bins!" << std::endl;
+		exit(1);
+	}
+
+	in.close();
+
+	return true;
+}
+
 // parse alignment-requests file
 void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments) {
-	std::ifstream al_in;
-	std::string tmpstr;
+	BenchmarkCache& cache = fp.benchmark_cache;
 	int id;
-	std::string block_id;
-	Block const* b1;
-	Block const* b2;
-	std::string handling_str;
-	std::string type_str;
-	int signals;
-	CorblivarAlignmentReq::Type type_x;
-	CorblivarAlignmentReq::Type type_y;
-	CorblivarAlignmentReq::Handling handling;
-	double alignment_x;
-	double alignment_y;
 
 	// sanity check for unavailable file
 	if (!fp.IO_conf.alignments_file_avail) {
@@ -777,12 +964,91 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 		std::cout << "Parsing alignment requests..." << std::endl;
 	}
 
-	// open file
-	al_in.open(fp.IO_conf.alignments_file.c_str());
+	// parse alignment-requests file, unless records were loaded from cache along
+	// w/ blocks
+	if (!cache.loaded) {
+		IO::parseAlignmentRequestsFile(fp);
+	}
 
 	// reset alignments
 	alignments.clear();
 
+	// derive alignment requests from parsed records
+	for (id = 0; id < static_cast<int>(cache.alignments.size()); id++) {
+
+		BenchmarkCache::AlignmentRecord const& record = cache.alignments[id];
+
+		alignments.push_back(CorblivarAlignmentReq(id, record.handling, record.signals,
+					record.s_i == RBOD::NUMERICAL_ID ? &fp.RBOD : &fp.blocks[record.s_i],
+					record.s_j == RBOD::NUMERICAL_ID ? &fp.RBOD : &fp.blocks[record.s_j],
+					record.type_x, record.alignment_x, record.type_y, record.alignment_y));
+	}
+
+	// update blocks' status according to alignments
+	for (CorblivarAlignmentReq& req : alignments) {
+
+		// memorize blocks with STRICT alignment request as not to be rotated;
+		// only if alignment is actually to be considered
+		if (req.handling == CorblivarAlignmentReq::Handling::STRICT && fp.opt_flags.alignment) {
+
+			if (req.s_i != &fp.RBOD) {
+				req.s_i->rotatable = false;
+			}
+
+			if (req.s_j != &fp.RBOD) {
+				req.s_j->rotatable = false;
+			}
+		}
+
+		// memorize pointer to vertical-bus requests
+		//
+		// link pointer to blocks only now, i.e., after all blocks are handled;
+		// otherwise, some new alignments will trigger reallocation of alignments
+		// vector and thus invalidate previous pointer
+		if (req.vertical_bus()) {
+
+			if (req.s_i != &fp.RBOD) {
+				req.s_i->alignments_vertical_bus.push_back(&req);
+			}
+
+			if (req.s_j != &fp.RBOD) {
+				req.s_j->alignments_vertical_bus.push_back(&req);
+			}
+		}
+	}
+
+	if (IO::DBG) {
+		for (CorblivarAlignmentReq const& req : alignments) {
+			std::cout << "DBG_IO> " << req.tupleString() << std::endl;
+		}
+	}
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; parsed " << id << " alignment requests" << std::endl << std::endl;
+	}
+}
+
+// parse alignment-requests file into records of benchmark cache; requires blocks
+void IO::parseAlignmentRequestsFile(FloorPlanner& fp) {
+	BenchmarkCache& cache = fp.benchmark_cache;
+	TokenStream al_in;
+	TokenStream::Token tmpstr;
+	std::string block_id;
+	Block const* b1;
+	Block const* b2;
+	TokenStream::Token handling_str;
+	TokenStream::Token type_str;
+	int signals;
+	CorblivarAlignmentReq::Type type_x;
+	CorblivarAlignmentReq::Type type_y;
+	CorblivarAlignmentReq::Handling handling;
+	double alignment_x;
+	double alignment_y;
+
+	// open file
+	al_in.open(fp.IO_conf.alignments_file);
+
 	// drop file header
 	while (tmpstr != "data_start" && !al_in.eof()) {
 		al_in >> tmpstr;
@@ -791,7 +1057,6 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 	// parse alignment tuples
 	// e.g.
 	// ( STRICT 64 sb1 sb2 MIN 50.0 MIN 100.0 )
-	id = 0;
 	while (!al_in.eof()) {
 
 		// drop "("
@@ -823,7 +1088,7 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 		al_in >> block_id;
 
 		// find related block
-		b1 = Block::findBlock(block_id, fp.blocks);
+		b1 = Block::findBlock(block_id, fp.blocks, fp.blocks_index);
 		// no parsed block found
 		if (b1 == nullptr) {
 
@@ -843,7 +1108,7 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 		al_in >> block_id;
 
 		// find related block
-		b2 = Block::findBlock(block_id, fp.blocks);
+		b2 = Block::findBlock(block_id, fp.blocks, fp.blocks_index);
 		// no parsed block found
 		if (b2 == nullptr) {
 
@@ -908,67 +1173,40 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 		// drop ");"
 		al_in >> tmpstr;
 
-		// generate and store successfully parsed request
-		alignments.push_back(CorblivarAlignmentReq(id, handling, signals, b1, b2, type_x, alignment_x, type_y, alignment_y));
-
-		id++;
+		// store successfully parsed request
+		cache.alignments.push_back({handling, signals, b1->numerical_id, b2->numerical_id, type_x, alignment_x, type_y, alignment_y});
 	}
 
-	// update blocks' status according to alignments
-	for (CorblivarAlignmentReq& req : alignments) {
-
-		// memorize blocks with STRICT alignment request as not to be rotated;
-		// only if alignment is actually to be considered
-		if (req.handling == CorblivarAlignmentReq::Handling::STRICT && fp.opt_flags.alignment) {
-
-			if (req.s_i != &fp.RBOD) {
-				req.s_i->rotatable = false;
-			}
-
-			if (req.s_j != &fp.RBOD) {
-				req.s_j->rotatable = false;
-			}
-		}
+	// close file
+	al_in.close();
+}
 
-		// memorize pointer to vertical-bus requests
-		//
-		// link pointer to blocks only now, i.e., after all blocks are handled;
-		// otherwise, some new alignments will trigger reallocation of alignments
-		// vector and thus invalidate previous pointer
-		if (req.vertical_bus()) {
+// write binary cache for pre-parsed benchmark files, if the records were parsed from
+// the files during this run; release records afterwards
+void IO::writeBenchmarkCache(FloorPlanner& fp) {
 
-			if (req.s_i != &fp.RBOD) {
-				req.s_i->alignments_vertical_bus.push_back(&req);
-			}
+	if (!fp.benchmark_cache.loaded) {
 
-			if (req.s_j != &fp.RBOD) {
-				req.s_j->alignments_vertical_bus.push_back(&req);
+		if (fp.benchmark_cache.write(fp.IO_conf.benchmark_cache_file)) {
+			if (fp.logMed()) {
+				std::cout << "IO> Pre-parsed benchmark written to cache file " << fp.IO_conf.benchmark_cache_file << std::endl << std::endl;
 			}
 		}
-	}
-
-	if (IO::DBG) {
-		for (CorblivarAlignmentReq const& req : alignments) {
-			std::cout << "DBG_IO> " << req.tupleString() << std::endl;
+		else if (fp.logMin()) {
+			std::cout << "IO> Cache file " << fp.IO_conf.benchmark_cache_file << " cannot be written; benchmark files will be parsed again for next run" << std::endl << std::endl;
 		}
 	}
 
-	if (fp.logMed()) {
-		std::cout << "IO> ";
-		std::cout << "Done; parsed " << id << " alignment requests" << std::endl << std::endl;
-	}
+	fp.benchmark_cache.clear();
 }
 
-// parse blocks file
+// parse blocks file; consider binary cache for pre-parsed benchmark files
 void IO::parseBlocks(FloorPlanner& fp) {
-	std::ifstream blocks_in, pins_in, power_in;
-	std::string tmpstr;
+	BenchmarkCache& cache = fp.benchmark_cache;
 	double power = 0.0;
 	double blocks_max_area = 0.0, blocks_avg_area = 0.0;
 	int soft_blocks = 0;
 	double blocks_outline_ratio;
-	std::string id;
-	unsigned to_parse_soft_blocks, to_parse_hard_blocks, to_parse_terminals;
 	bool floorplacement;
 
 	if (fp.logMed()) {
@@ -976,135 +1214,87 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		std::cout << "Parsing blocks..." << std::endl;
 	}
 
-	// open files
-	blocks_in.open(fp.IO_conf.blocks_file.c_str());
-	pins_in.open(fp.IO_conf.pins_file.c_str());
-	power_in.open(fp.IO_conf.power_density_file.c_str());
+	// the cache is only valid for unchanged benchmark files, thus consider hashes
+	// of all these files
+	cache.init({{
+			BenchmarkCache::hashFile(fp.IO_conf.blocks_file),
+			BenchmarkCache::hashFile(fp.IO_conf.pins_file),
+			fp.IO_conf.power_density_file_avail ? BenchmarkCache::hashFile(fp.IO_conf.power_density_file) : 0,
+			BenchmarkCache::hashFile(fp.IO_conf.nets_file),
+			fp.IO_conf.alignments_file_avail ? BenchmarkCache::hashFile(fp.IO_conf.alignments_file) : 0
+		}});
 
-	// drop power density file header line
-	if (fp.IO_conf.power_density_file_avail) {
-		while (tmpstr != "end" && !power_in.eof())
-			power_in >> tmpstr;
-		// if we reached eof, there was no header line; reset the input stream
-		if (power_in.eof()) {
-			power_in.clear() ;
-			power_in.seekg(0, power_in.beg);
+	if (cache.load(fp.IO_conf.benchmark_cache_file)) {
+		if (fp.logMed()) {
+			std::cout << "IO>  Pre-parsed benchmark loaded from cache file " << fp.IO_conf.benchmark_cache_file << std::endl;
 		}
 	}
+	else {
+		IO::parseBlocksFiles(fp);
+	}
 
 	// reset blocks
 	fp.IC.blocks_area = 0.0;
 	fp.blocks.clear();
+	fp.blocks_index.clear();
 	// reset terminals
 	fp.terminals.clear();
+	fp.terminals_index.clear();
 
 	// reset blocks power statistics
 	fp.power_stats.max = fp.power_stats.range = fp.power_stats.avg = 0.0;
 	fp.power_stats.min = -1;
 
-	// drop block files header
-	while (tmpstr != "NumSoftRectangularBlocks" && !blocks_in.eof())
-		blocks_in >> tmpstr;
-	// drop ":"
-	blocks_in >> tmpstr;
-	// memorize how many soft blocks to be parsed
-	blocks_in >> to_parse_soft_blocks;
-	// drop "NumHardRectilinearBlocks" and ":"
-	blocks_in >> tmpstr;
-	blocks_in >> tmpstr;
-	// memorize how many hard blocks to be parsed
-	blocks_in >> to_parse_hard_blocks;
-	// drop "NumTerminals" and ":"
-	blocks_in >> tmpstr;
-	blocks_in >> tmpstr;
-	// memorize how many terminal pins to be parsed
-	blocks_in >> to_parse_terminals;
-
-	// parse blocks and pins
-	while (!blocks_in.eof()) {
-
-		// each line contains a block, two examples are below
-		// bk1 hardrectilinear 4 (0, 0) (0, 133) (336, 133) (336, 0)
-		// BLOCK_7 softrectangular 2464 0.33 3.0
-		// VSS terminal
-
-		// parse block identifier
-		blocks_in >> id;
-
-		// init block / pin
-		Block new_block = Block(id);
-		Pin new_pin = Pin(id);
+	// derive blocks and pins from parsed records
+	for (unsigned r = 0; r < cache.blocks.size(); r++) {
 
-		// parse block type
-		blocks_in >> tmpstr;
+		BenchmarkCache::BlockRecord const& record = cache.blocks[r];
+		std::string const& id = cache.blocks_ids[r];
 
 		// terminal pins: store separately
-		if (tmpstr == "terminal") {
+		if (record.type == BenchmarkCache::BlockType::TERMINAL) {
 
-			// parse pins file for related coordinates
-			while (tmpstr != id && !pins_in.eof()) {
-				pins_in >> tmpstr;
-			}
+			Pin new_pin = Pin(id);
 
 			// pin cannot be found; log
-			if (pins_in.eof() && fp.logMin()) {
-				std::cout << "IO>  Coordinates for pin \"" << id << "\" cannot be retrieved, consider checking the pins file!" << std::endl;
+			if (record.missing) {
+				if (fp.logMin()) {
+					std::cout << "IO>  Coordinates for pin \"" << id << "\" cannot be retrieved, consider checking the pins file!" << std::endl;
+				}
 			}
-			// initially, parse coordinates of found pin; they will be scaled
-			// after parsing whole blocks file
+			// initially, consider coordinates of found pin; they will be
+			// scaled after parsing whole blocks file
 			else {
-				pins_in >> new_pin.bb.ll.x;
-				pins_in >> new_pin.bb.ll.y;
+				new_pin.bb.ll.x = record.values[0];
+				new_pin.bb.ll.y = record.values[1];
 			}
 
-			// store pin
+			// store pin; also memorize its numerical id
+			new_pin.numerical_id = fp.terminals.size();
+			fp.terminals_index.emplace(id, new_pin.numerical_id);
 			fp.terminals.push_back(new_pin);
 
-			// reset pins file stream for next search
-			pins_in.clear() ;
-			pins_in.seekg(0, pins_in.beg);
-
 			// skip further block related handling
 			continue;
 		}
-		// hard blocks: parse dimensions
-		else if (tmpstr == "hardrectilinear") {
 
-			// drop "4"
-			blocks_in >> tmpstr;
-			// drop "(0,"
-			blocks_in >> tmpstr;
-			// drop "0)"
-			blocks_in >> tmpstr;
-			// drop "(0,"
-			blocks_in >> tmpstr;
-			// drop "Y)"
-			blocks_in >> tmpstr;
-			// parse "(X,"
-			blocks_in >> tmpstr;
-			new_block.bb.w = atof(tmpstr.substr(1, tmpstr.size() - 2).c_str());
-			// parse "Y)"
-			blocks_in >> tmpstr;
-			new_block.bb.h = atof(tmpstr.substr(0, tmpstr.size() - 1).c_str());
-			// drop "(X,"
-			blocks_in >> tmpstr;
-			// drop "0)"
-			blocks_in >> tmpstr;
+		Block new_block = Block(id);
+
+		// hard blocks: dimensions
+		if (record.type == BenchmarkCache::BlockType::HARD) {
 
 			// scale up dimensions
-			new_block.bb.w *= fp.IC.blocks_scale;
-			new_block.bb.h *= fp.IC.blocks_scale;
+			new_block.bb.w = record.values[0] * fp.IC.blocks_scale;
+			new_block.bb.h = record.values[1] * fp.IC.blocks_scale;
 
 			// calculate block area
 			new_block.bb.area = new_block.bb.w * new_block.bb.h;
 		}
-		// soft blocks: parse area and AR range
-		else if (tmpstr == "softrectangular") {
-
-			// parse area, min AR, max AR
-			blocks_in >> new_block.bb.area;
-			blocks_in >> new_block.AR.min;
-			blocks_in >> new_block.AR.max;
+		// soft blocks: area and AR range
+		else {
+			new_block.bb.area = record.values[0];
+			new_block.AR.min = record.values[1];
+			new_block.AR.max = record.values[2];
 
 			// scale up blocks area
 			new_block.bb.area *= std::pow(fp.IC.blocks_scale, 2);
@@ -1117,28 +1307,11 @@ void IO::parseBlocks(FloorPlanner& fp) {
 			// memorize soft blocks count
 			soft_blocks++;
 		}
-		// due to some blank lines at the end, we may have reached eof just now
-		else if (blocks_in.eof()) {
-			break;
-		}
-		// unknown block type
-		else {
-			std::cout << "IO>  Unknown block type: " << tmpstr << std::endl;
-			std::cout << "IO>  Consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
-			exit(1);
-		}
 
 		// determine power density
 		if (fp.IO_conf.power_density_file_avail) {
-			if (!power_in.eof()) {
-				power_in >> new_block.power_density;
-				// GSRC benchmarks provide power density in 10^5 W/m^2
-				// which equals 10^-1 uW/um^2; scale by factor 10 in order
-				// to obtain uW/um^2
-				//
-				// (TODO) scaling up ignored in order to limit
-				// power-density to reasonable values
-				//new_block.power_density *= 10.0;
+			if (!record.missing) {
+				new_block.power_density = record.power_density;
 			}
 			else {
 				if (fp.logMin()) {
@@ -1160,15 +1333,12 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		fp.IC.blocks_area += new_block.bb.area;
 		blocks_max_area = std::max(blocks_max_area, new_block.bb.area);
 
-		// store block
+		// store block; also memorize its numerical id
+		new_block.numerical_id = fp.blocks.size();
+		fp.blocks_index.emplace(id, new_block.numerical_id);
 		fp.blocks.push_back(std::move(new_block));
 	}
 
-	// close files
-	blocks_in.close();
-	power_in.close();
-	pins_in.close();
-
 	// determine deadspace amount for whole stack, now that the occupied blocks area
 	// is known
 	fp.IC.stack_deadspace = fp.IC.stack_area - fp.IC.blocks_area;
@@ -1210,16 +1380,16 @@ void IO::parseBlocks(FloorPlanner& fp) {
 	}
 
 	// sanity check for parsed blocks
-	if (fp.blocks.size() != (to_parse_soft_blocks + to_parse_hard_blocks)) {
+	if (fp.blocks.size() != (cache.soft_blocks + cache.hard_blocks)) {
 		std::cout << "IO>  Not all given blocks could be parsed; consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
-		std::cout << "IO>   Parsed hard blocks: " << fp.blocks.size() - soft_blocks << ", expected hard blocks count: " << to_parse_hard_blocks << std::endl;
+		std::cout << "IO>   Parsed hard blocks: " << fp.blocks.size() - soft_blocks << ", expected hard blocks count: " << cache.hard_blocks << std::endl;
 		exit(1);
 	}
 
 	// sanity check for parsed terminals
-	if (fp.terminals.size() != to_parse_terminals) {
+	if (fp.terminals.size() != cache.terminals) {
 		std::cout << "IO>  Not all given terminals could be parsed; consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
-		std::cout << "IO>   Parsed pins: " << fp.terminals.size() << ", expected pins count: " << to_parse_terminals << std::endl;
+		std::cout << "IO>   Parsed pins: " << fp.terminals.size() << ", expected pins count: " << cache.terminals << std::endl;
 		exit(1);
 	}
 
@@ -1253,28 +1423,277 @@ void IO::parseBlocks(FloorPlanner& fp) {
 	}
 }
 
+// parse blocks, pins, and power density files into records of benchmark cache
+void IO::parseBlocksFiles(FloorPlanner& fp) {
+	BenchmarkCache& cache = fp.benchmark_cache;
+	TokenStream blocks_in, pins_in, power_in;
+	TokenStream::Token tmpstr;
+	std::string id;
+	std::vector<TokenStream::Token> pins_tokens;
+	std::unordered_map<std::string, unsigned> pins_tokens_index;
+	std::unordered_map<std::string, unsigned>::const_iterator pin_token;
+
+	// open files
+	blocks_in.open(fp.IO_conf.blocks_file);
+	pins_in.open(fp.IO_conf.pins_file);
+	power_in.open(fp.IO_conf.power_density_file);
+
+	// drop power density file header line
+	if (fp.IO_conf.power_density_file_avail) {
+		while (tmpstr != "end" && !power_in.eof())
+			power_in >> tmpstr;
+		// if we reached eof, there was no header line; reset the input stream
+		if (power_in.eof()) {
+			power_in.rewind();
+		}
+	}
+
+	// parse pins file once; memorize the first occurrence of each token, such
+	// that the coordinates of terminal pins can be looked up via the pins' ids
+	while (pins_in >> tmpstr) {
+		pins_tokens_index.emplace(tmpstr.str(), pins_tokens.size());
+		pins_tokens.push_back(tmpstr);
+	}
+
+	// drop block files header
+	while (tmpstr != "NumSoftRectangularBlocks" && !blocks_in.eof())
+		blocks_in >> tmpstr;
+	// drop ":"
+	blocks_in >> tmpstr;
+	// memorize how many soft blocks to be parsed
+	blocks_in >> cache.soft_blocks;
+	// drop "NumHardRectilinearBlocks" and ":"
+	blocks_in >> tmpstr;
+	blocks_in >> tmpstr;
+	// memorize how many hard blocks to be parsed
+	blocks_in >> cache.hard_blocks;
+	// drop "NumTerminals" and ":"
+	blocks_in >> tmpstr;
+	blocks_in >> tmpstr;
+	// memorize how many terminal pins to be parsed
+	blocks_in >> cache.terminals;
+
+	// parse blocks and pins
+	while (!blocks_in.eof()) {
+		BenchmarkCache::BlockRecord record = BenchmarkCache::BlockRecord();
+
+		// each line contains a block, two examples are below
+		// bk1 hardrectilinear 4 (0, 0) (0, 133) (336, 133) (336, 0)
+		// BLOCK_7 softrectangular 2464 0.33 3.0
+		// VSS terminal
+
+		// parse block identifier; due to some blank lines at the end, we may
+		// have reached eof just now
+		if (!(blocks_in >> id)) {
+			break;
+		}
+
+		// parse block type
+		blocks_in >> tmpstr;
+
+		// terminal pins
+		if (tmpstr == "terminal") {
+
+			record.type = BenchmarkCache::BlockType::TERMINAL;
+
+			// look up pin in pins file for related coordinates
+			pin_token = pins_tokens_index.find(id);
+
+			// pin cannot be found
+			if (pin_token == pins_tokens_index.end() || pin_token->second + 2 >= pins_tokens.size()) {
+				record.missing = true;
+			}
+			// parse coordinates of found pin
+			else {
+				record.values[0] = TokenStream::toDouble(pins_tokens[pin_token->second + 1]);
+				record.values[1] = TokenStream::toDouble(pins_tokens[pin_token->second + 2]);
+			}
+
+			// store record
+			cache.blocks.push_back(record);
+			cache.blocks_ids.push_back(id);
+
+			// skip further block related handling
+			continue;
+		}
+		// hard blocks: parse dimensions
+		else if (tmpstr == "hardrectilinear") {
+
+			record.type = BenchmarkCache::BlockType::HARD;
+
+			// drop "4"
+			blocks_in >> tmpstr;
+			// drop "(0,"
+			blocks_in >> tmpstr;
+			// drop "0)"
+			blocks_in >> tmpstr;
+			// drop "(0,"
+			blocks_in >> tmpstr;
+			// drop "Y)"
+			blocks_in >> tmpstr;
+			// parse "(X,"
+			blocks_in >> tmpstr;
+			record.values[0] = TokenStream::toDouble(tmpstr.data + 1, tmpstr.data + tmpstr.size - 1);
+			// parse "Y)"
+			blocks_in >> tmpstr;
+			record.values[1] = TokenStream::toDouble(tmpstr.data, tmpstr.data + tmpstr.size - 1);
+			// drop "(X,"
+			blocks_in >> tmpstr;
+			// drop "0)"
+			blocks_in >> tmpstr;
+		}
+		// soft blocks: parse area and AR range
+		else if (tmpstr == "softrectangular") {
+
+			record.type = BenchmarkCache::BlockType::SOFT;
+
+			// parse area, min AR, max AR
+			blocks_in >> record.values[0];
+			blocks_in >> record.values[1];
+			blocks_in >> record.values[2];
+		}
+		// due to some blank lines at the end, we may have reached eof just now
+		else if (blocks_in.eof()) {
+			break;
+		}
+		// unknown block type
+		else {
+			std::cout << "IO>  Unknown block type: " << tmpstr << std::endl;
+			std::cout << "IO>  Consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
+			exit(1);
+		}
+
+		// parse power density
+		if (fp.IO_conf.power_density_file_avail) {
+			if (!power_in.eof()) {
+				power_in >> record.power_density;
+				// GSRC benchmarks provide power density in 10^5 W/m^2
+				// which equals 10^-1 uW/um^2; scale by factor 10 in order
+				// to obtain uW/um^2
+				//
+				// (TODO) scaling up ignored in order to limit
+				// power-density to reasonable values
+				//record.power_density *= 10.0;
+			}
+			else {
+				record.missing = true;
+			}
+		}
+
+		// store record
+		cache.blocks.push_back(record);
+		cache.blocks_ids.push_back(id);
+	}
+
+	// close files
+	blocks_in.close();
+	power_in.close();
+	pins_in.close();
+}
+
 // parse nets file
 void IO::parseNets(FloorPlanner& fp) {
-	std::ifstream in;
-	std::string tmpstr;
-	int i, net_degree;
-	std::string net_block;
-	Block const* block;
-	Pin const* pin;
-	int id;
-	bool block_not_found, pin_not_found;
-	unsigned to_parse_nets;
+	BenchmarkCache& cache = fp.benchmark_cache;
+	unsigned n, p;
 
 	if (fp.logMed()) {
 		std::cout << "IO> ";
 		std::cout << "Parsing nets..." << std::endl;
 	}
 
+	// parse nets file, unless records were loaded from cache along w/ blocks
+	if (!cache.loaded) {
+		IO::parseNetsFile(fp);
+	}
+
 	// reset nets
 	fp.nets.clear();
+	fp.nets.reserve(cache.nets_offsets.size());
+
+	// derive nets from parsed records
+	for (n = 0; n + 1 < cache.nets_offsets.size(); n++) {
+		Net new_net = Net(n);
+
+		for (p = cache.nets_offsets[n]; p < cache.nets_offsets[n + 1]; p++) {
+
+			BenchmarkCache::NetPin const& pin = cache.nets_pins[p];
+
+			if (pin.type == BenchmarkCache::PinType::TERMINAL) {
+				// mark net as net w/ external pin
+				new_net.hasExternalPin = true;
+				// store terminal
+				new_net.terminals.push_back(&fp.terminals[pin.handle]);
+			}
+			else if (pin.type == BenchmarkCache::PinType::BLOCK) {
+				// store block
+				new_net.blocks.push_back(&fp.blocks[pin.handle]);
+			}
+			// log pin parsing failure
+			else if (fp.logMin()) {
+				std::cout << "IO>  Net " << n << "'s terminal pin \"" << cache.unresolved_pins[pin.handle] << "\"";
+				std::cout << " cannot be retrieved; consider checking net / blocks file" << std::endl;
+			}
+		}
+
+		// store net
+		fp.nets.push_back(std::move(new_net));
+	}
+
+	if (IO::DBG) {
+		for (Net const& n : fp.nets) {
+			std::cout << "DBG_IO> ";
+			std::cout << "net " << n.id << std::endl;
+
+			for (Block const* block : n.blocks) {
+				std::cout << "DBG_IO> ";
+				std::cout << " block " << block->id << std::endl;
+			}
+
+			for (Pin const* pin : n.terminals) {
+				std::cout << "DBG_IO> ";
+				std::cout << " pin " << pin->id << std::endl;
+			}
+		}
+	}
+
+	// derive nets of each block, required for incremental evaluation of
+	// interconnects
+	fp.blocks_nets.assign(fp.blocks.size(), std::vector<unsigned>());
+	for (unsigned n = 0; n < fp.nets.size(); n++) {
+		for (Block const* b : fp.nets[n].blocks) {
+			fp.blocks_nets[b->numerical_id].push_back(n);
+		}
+	}
+
+	// derive compact representation of nets
+	fp.netlist.init(fp.nets, fp.IC.layers);
+
+	// sanity check for parsed nets
+	if (fp.nets.size() != cache.nets) {
+		std::cout << "IO>  Not all given nets could be parsed; consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
+		std::cout << "IO>   Parsed nets: " << fp.nets.size() << ", expected nets count: " << cache.nets << std::endl;
+		exit(1);
+	}
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; " << fp.nets.size() << " nets read in" << std::endl << std::endl;
+	}
+
+}
+
+// parse nets file into records of benchmark cache; requires blocks and terminal pins
+void IO::parseNetsFile(FloorPlanner& fp) {
+	BenchmarkCache& cache = fp.benchmark_cache;
+	TokenStream in;
+	TokenStream::Token tmpstr;
+	int i, net_degree;
+	std::string net_block;
+	Block const* block;
+	Pin const* pin;
 
 	// open nets file
-	in.open(fp.IO_conf.nets_file.c_str());
+	in.open(fp.IO_conf.nets_file);
 
 	// drop nets file header
 	while (tmpstr != "NumNets" && !in.eof())
@@ -1282,12 +1701,10 @@ void IO::parseNets(FloorPlanner& fp) {
 	// drop ":"
 	in >> tmpstr;
 	// memorize how many nets to be parsed
-	in >> to_parse_nets;
+	in >> cache.nets;
 
 	// parse nets file
-	id = 0;
 	while (!in.eof()) {
-		Net new_net = Net(id);
 
 		// parse net degree
 		//// NetDegree : 2
@@ -1306,98 +1723,37 @@ void IO::parseNets(FloorPlanner& fp) {
 		}
 
 		// read in blocks and terminals of net
-		new_net.blocks.clear();
-		new_net.terminals.clear();
+		cache.nets_offsets.push_back(cache.nets_pins.size());
 		for (i = 0; i < net_degree; i++) {
 
 			// parse block / pin id
 			in >> net_block;
 
-			// try to interpret as terminal pin
-			pin = Pin::findPin(net_block, fp.terminals);
+			// try to interpret as terminal pin, otherwise as regular block
+			pin = Pin::findPin(net_block, fp.terminals, fp.terminals_index);
 			if (pin != nullptr) {
-				// mark net as net w/ external pin
-				new_net.hasExternalPin = true;
-				// store terminal
-				new_net.terminals.push_back(std::move(pin));
-				// pin found
-				pin_not_found = false;
+				cache.nets_pins.push_back({BenchmarkCache::PinType::TERMINAL, static_cast<unsigned>(pin->numerical_id)});
 			}
 			else {
-				// pin not found
-				pin_not_found = true;
-			}
-
-			// try to interpret as regular block 
-			if (pin_not_found) {
-				block = Block::findBlock(net_block, fp.blocks);
+				block = Block::findBlock(net_block, fp.blocks, fp.blocks_index);
 				if (block != nullptr) {
-					// store block
-					new_net.blocks.push_back(std::move(block));
-					// block found
-					block_not_found = false;
+					cache.nets_pins.push_back({BenchmarkCache::PinType::BLOCK, static_cast<unsigned>(block->numerical_id)});
 				}
+				// memorize name of unresolved pin for logging
 				else {
-					// block not found
-					block_not_found = true;
+					cache.nets_pins.push_back({BenchmarkCache::PinType::UNRESOLVED, static_cast<unsigned>(cache.unresolved_pins.size())});
+					cache.unresolved_pins.push_back(net_block);
 				}
 			}
 
 			// drop "B"
 			in >> tmpstr;
-
-			// log pin parsing failure
-			if (fp.logMin()) {
-				if (block_not_found && !pin_not_found) {
-					std::cout << "IO>  Net " << id << "'s block \"" << net_block << "\"";
-					std::cout << " cannot be retrieved; consider checking net / blocks file" << std::endl;
-				}
-				else if (block_not_found && pin_not_found) {
-					std::cout << "IO>  Net " << id << "'s terminal pin \"" << net_block << "\"";
-					std::cout << " cannot be retrieved; consider checking net / blocks file" << std::endl;
-				}
-			}
 		}
-
-		// store net
-		fp.nets.push_back(std::move(new_net));
-
-		// consider next net id
-		id++;
 	}
+	cache.nets_offsets.push_back(cache.nets_pins.size());
 
 	// close nets file
 	in.close();
-
-	if (IO::DBG) {
-		for (Net const& n : fp.nets) {
-			std::cout << "DBG_IO> ";
-			std::cout << "net " << n.id << std::endl;
-
-			for (Block const* block : n.blocks) {
-				std::cout << "DBG_IO> ";
-				std::cout << " block " << block->id << std::endl;
-			}
-
-			for (Pin const* pin : n.terminals) {
-				std::cout << "DBG_IO> ";
-				std::cout << " pin " << pin->id << std::endl;
-			}
-		}
-	}
-
-	// sanity check for parsed nets
-	if (fp.nets.size() != to_parse_nets) {
-		std::cout << "IO>  Not all given nets could be parsed; consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
-		std::cout << "IO>   Parsed nets: " << fp.nets.size() << ", expected nets count: " << to_parse_nets << std::endl;
-		exit(1);
-	}
-
-	if (fp.logMed()) {
-		std::cout << "IO> ";
-		std::cout << "Done; " << fp.nets.size() << " nets read in" << std::endl << std::endl;
-	}
-
 }
 
 void IO::writeMaps(FloorPlanner& fp) {
@@ -1405,8 +1761,8 @@ void IO::writeMaps(FloorPlanner& fp) {
 	std::ofstream data_out;
 	int cur_layer;
 	int layer_limit;
-	unsigned x, y;
-	enum FLAGS : int {POWER = 0, THERMAL = 1, ROUTING = 2, TSV_DENSITY = 3};
+	int x, y;
+	enum FLAGS : int {POWER = 0, THERMAL = 1, ROUTING = 2, TSV_DENSITY = 3, THERMAL_SOLVER = 4};
 	int flag, flag_start, flag_stop;
 	double max_temp, min_temp;
 	int id;
@@ -1433,9 +1789,10 @@ void IO::writeMaps(FloorPlanner& fp) {
 	// flag=1: generate thermal map
 	// flag=2: generate routing-utilization map
 	// flag=3: generate TSV-density map
+	// flag=4: generate steady-state thermal maps, if thermal solver was run
 	//
 	// for regular runs, generate all sets; for thermal-analyzer runs, only generate
-	// the required thermal map
+	// the required thermal map(s)
 	flag_start = flag_stop = -1;
 	if (fp.thermal_analyser_run) {
 		flag_start = flag_stop = FLAGS::THERMAL;
@@ -1444,15 +1801,24 @@ void IO::writeMaps(FloorPlanner& fp) {
 		flag_start = FLAGS::POWER;
 		flag_stop = FLAGS::TSV_DENSITY;
 	}
+	if (!fp.thermal_solver_result.temp.empty()) {
+		flag_stop = FLAGS::THERMAL_SOLVER;
+	}
 	//
 	// actual map generation	
 	for (flag = flag_start; flag <= flag_stop; flag++) {
 
+		// thermal-analyzer runs; skip maps other than thermal maps
+		if (fp.thermal_analyser_run && flag != FLAGS::THERMAL && flag != FLAGS::THERMAL_SOLVER) {
+			continue;
+		}
+
 		// thermal map only for layer 0
 		if (flag == FLAGS::THERMAL) {
 			layer_limit = 1;
 		}
-		// power, routing-utilization and TSV-density maps for all layers
+		// power, routing-utilization, TSV-density and steady-state thermal
+		// maps for all layers
 		else {
 			layer_limit = fp.IC.layers;
 		}
@@ -1477,6 +1843,10 @@ void IO::writeMaps(FloorPlanner& fp) {
 				gp_out_name << fp.benchmark << "_" << cur_layer + 1 << "_routing_util.gp";
 				data_out_name << fp.benchmark << "_" << cur_layer + 1 << "_routing_util.data";
 			}
+			else if (flag == FLAGS::THERMAL_SOLVER) {
+				gp_out_name << fp.benchmark << "_" << cur_layer + 1 << "_thermal_solver.gp";
+				data_out_name << fp.benchmark << "_" << cur_layer + 1 << "_thermal_solver.data";
+			}
 
 			// init file stream for gnuplot script
 			gp_out.open(gp_out_name.str().c_str());
@@ -1496,25 +1866,28 @@ void IO::writeMaps(FloorPlanner& fp) {
 			else if (flag == FLAGS::ROUTING) {
 				data_out << "# X Y routing_util" << std::endl;
 			}
+			else if (flag == FLAGS::THERMAL_SOLVER) {
+				data_out << "# X Y thermal_solver" << std::endl;
+			}
 
 			// output grid values for power maps
 			if (flag == FLAGS::POWER) {
 
-				for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x][y].power_density << std::endl;
+				for (x = 0; x < fp.thermalAnalyzer.power_maps_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.power_maps_dim; y++) {
+						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer].power_density[x][y] << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::POWER_MAPS_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.power_maps_dim << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-					data_out << ThermalAnalyzer::POWER_MAPS_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.power_maps_dim; y++) {
+					data_out << fp.thermalAnalyzer.power_maps_dim << "	" << y << "	" << "0.0" << std::endl;
 				}
 
 			}
@@ -1523,8 +1896,8 @@ void IO::writeMaps(FloorPlanner& fp) {
 				max_temp = 0.0;
 				min_temp = 1.0e6;
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.thermal_map_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.thermal_map_dim; y++) {
 						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.thermal_map[x][y].temp << std::endl;
 						// also track max and min temp
 						max_temp = std::max(max_temp, fp.thermalAnalyzer.thermal_map[x][y].temp);
@@ -1532,60 +1905,85 @@ void IO::writeMaps(FloorPlanner& fp) {
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.thermal_map_dim << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.thermal_map_dim; y++) {
+					data_out << fp.thermalAnalyzer.thermal_map_dim << "	" << y << "	" << "0.0" << std::endl;
 				}
 			}
 			// output grid values for TSV-density maps; consider only bin bins
 			// w/in die outline, not in padded zone
 			else if (flag == FLAGS::TSV_DENSITY) {
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.thermal_map_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.thermal_map_dim; y++) {
 						// access map bins w/ offset related to
 						// padding zone
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS].TSV_density << std::endl;
+						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer].TSV_density[x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS] << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.thermal_map_dim << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.thermal_map_dim; y++) {
+					data_out << fp.thermalAnalyzer.thermal_map_dim << "	" << y << "	" << "0.0" << std::endl;
 				}
 			}
 			// output grid values for routing-utilization maps
 			if (flag == FLAGS::ROUTING) {
 
-				for (x = 0; x < RoutingUtilization::UTIL_MAPS_DIM; x++) {
-					for (y = 0; y < RoutingUtilization::UTIL_MAPS_DIM; y++) {
+				for (x = 0; x < fp.routingUtil.util_maps_dim; x++) {
+					for (y = 0; y < fp.routingUtil.util_maps_dim; y++) {
 						data_out << x << "	" << y << "	" << fp.routingUtil.util_maps[cur_layer][x][y].utilization << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << RoutingUtilization::UTIL_MAPS_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.routingUtil.util_maps_dim << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= RoutingUtilization::UTIL_MAPS_DIM; y++) {
-					data_out << RoutingUtilization::UTIL_MAPS_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.routingUtil.util_maps_dim; y++) {
+					data_out << fp.routingUtil.util_maps_dim << "	" << y << "	" << "0.0" << std::endl;
+				}
+
+			}
+			// output grid values for steady-state thermal maps
+			else if (flag == FLAGS::THERMAL_SOLVER) {
+				max_temp = 0.0;
+				min_temp = 1.0e6;
+
+				for (x = 0; x < fp.thermalAnalyzer.thermal_map_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.thermal_map_dim; y++) {
+						data_out << x << "	" << y << "	" << fp.thermal_solver_result.temp[cur_layer][x][y] << std::endl;
+						// also track max and min temp
+						max_temp = std::max(max_temp, fp.thermal_solver_result.temp[cur_layer][x][y]);
+						min_temp = std::min(min_temp, fp.thermal_solver_result.temp[cur_layer][x][y]);
+					}
+
+					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
+					data_out << x << "	" << fp.thermalAnalyzer.thermal_map_dim << "	" << "0.0" << std::endl;
+
+					// blank line marks new row for gnuplot
+					data_out << std::endl;
 				}
 
+				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
+				for (y = 0; y <= fp.thermalAnalyzer.thermal_map_dim; y++) {
+					data_out << fp.thermalAnalyzer.thermal_map_dim << "	" << y << "	" << "0.0" << std::endl;
+				}
 			}
 
 			// close file stream for data file
@@ -1604,6 +2002,9 @@ void IO::writeMaps(FloorPlanner& fp) {
 			else if (flag == FLAGS::ROUTING) {
 				gp_out << "set title \"Routing-Utilization Map - " << fp.benchmark << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
 			}
+			else if (flag == FLAGS::THERMAL_SOLVER) {
+				gp_out << "set title \"Steady-State Thermal Map - " << fp.benchmark << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
+			}
 
 			gp_out << "set terminal pdfcairo enhanced font \"Gill Sans, 12\"" << std::endl;
 			gp_out << "set output \"" << gp_out_name.str() << ".pdf\"" << std::endl;
@@ -1613,16 +2014,16 @@ void IO::writeMaps(FloorPlanner& fp) {
 			// column, since gnuplot option corners2color cuts off last row
 			// and column
 			if (flag == FLAGS::POWER) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.power_maps_dim << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.power_maps_dim << "]" << std::endl;
 			}
-			else if (flag == FLAGS::THERMAL	|| flag == FLAGS::TSV_DENSITY) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
+			else if (flag == FLAGS::THERMAL	|| flag == FLAGS::TSV_DENSITY || flag == FLAGS::THERMAL_SOLVER) {
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.thermal_map_dim << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.thermal_map_dim << "]" << std::endl;
 			}
 			else if (flag == FLAGS::ROUTING) {
-				gp_out << "set xrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << fp.routingUtil.util_maps_dim << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.routingUtil.util_maps_dim << "]" << std::endl;
 			}
 
 			// power maps
@@ -1654,6 +2055,12 @@ void IO::writeMaps(FloorPlanner& fp) {
 				// label for utilization
 				gp_out << "set cblabel \"Estimated Routing Utilization\"" << std::endl;
 			}
+			// steady-state thermal maps
+			else if (flag == FLAGS::THERMAL_SOLVER) {
+				// fixed scale to avoid remapping to extended range
+				gp_out << "set cbrange [" << min_temp << ":" << max_temp << "]" << std::endl;
+				gp_out << "set cblabel \"Temperature [K]\"" << std::endl;
+			}
 
 			// tics
 			gp_out << "set tics front" << std::endl;
@@ -1683,8 +2090,8 @@ void IO::writeMaps(FloorPlanner& fp) {
 			if (flag == FLAGS::POWER && ThermalAnalyzer::POWER_MAPS_PADDED_BINS > 0) {
 				gp_out << "set obj 1 rect from ";
 				gp_out << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", " << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " to ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " ";
+				gp_out << fp.thermalAnalyzer.power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", ";
+				gp_out << fp.thermalAnalyzer.power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " ";
 				gp_out << "front fillstyle empty border rgb \"white\" linewidth 3" << std::endl;
 			}
 
@@ -1693,8 +2100,8 @@ void IO::writeMaps(FloorPlanner& fp) {
 
 				id = 1;
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.thermal_map_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.thermal_map_dim; y++) {
 
 						// mark bins belonging to a hotspot region
 						if (fp.thermalAnalyzer.thermal_map[x][y].hotspot_id != ThermalAnalyzer::HOTSPOT_UNDEFINED &&
@@ -1746,6 +2153,83 @@ void IO::writeMaps(FloorPlanner& fp) {
 	}
 }
 
+// machine-readable report of phase timers, as JSON
+void IO::writePerformanceReport(FloorPlanner const& fp) {
+	std::ofstream file;
+	std::vector<PhaseTimers::PhaseStats> phases;
+	std::vector<PhaseTimers::SAPhaseStats> SA_phases;
+	std::vector<PhaseTimers::CacheStats> cache;
+	unsigned p;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Writing performance report ..." << std::endl;
+	}
+
+	phases = PhaseTimers::mergedPhaseStats();
+	SA_phases = PhaseTimers::mergedSAPhaseStats();
+	cache = PhaseTimers::mergedCacheStats();
+
+	// build up file name
+	std::stringstream file_name;
+	file_name << fp.benchmark << ".perf.json";
+
+	// init file stream
+	file.open(file_name.str().c_str());
+
+	// file header
+	file << "{" << std::endl;
+	file << "  \"benchmark\": \"" << fp.benchmark << "\"," << std::endl;
+
+	// phases; times in seconds
+	file << "  \"phases\": [" << std::endl;
+	for (p = 0; p < phases.size(); p++) {
+		file << "    {";
+		file << "\"name\": \"" << phases[p].name << "\", ";
+		file << "\"calls\": " << phases[p].calls << ", ";
+		file << "\"total\": " << phases[p].total << ", ";
+		file << "\"mean\": " << phases[p].mean << ", ";
+		file << "\"p99\": " << phases[p].p99;
+		file << "}" << (p + 1 < phases.size() ? "," : "") << std::endl;
+	}
+	file << "  ]," << std::endl;
+
+	// SA phases
+	file << "  \"SA_phases\": [" << std::endl;
+	for (p = 0; p < SA_phases.size(); p++) {
+		file << "    {";
+		file << "\"name\": \"" << SA_phases[p].name << "\", ";
+		file << "\"ops\": " << SA_phases[p].ops << ", ";
+		file << "\"time\": " << SA_phases[p].time << ", ";
+		file << "\"ops_per_sec\": " << SA_phases[p].ops_per_sec;
+		file << "}" << (p + 1 < SA_phases.size() ? "," : "") << std::endl;
+	}
+	file << "  ]," << std::endl;
+
+	// evaluation cache, for each SA phase; time saved in seconds, only by
+	// rejected hits
+	file << "  \"evaluation_cache\": [" << std::endl;
+	for (p = 0; p < cache.size(); p++) {
+		file << "    {";
+		file << "\"name\": \"" << cache[p].name << "\", ";
+		file << "\"lookups\": " << cache[p].lookups << ", ";
+		file << "\"hits\": " << cache[p].hits << ", ";
+		file << "\"hit_rate\": " << cache[p].hit_rate << ", ";
+		file << "\"time_saved\": " << cache[p].time_saved;
+		file << "}" << (p + 1 < cache.size() ? "," : "") << std::endl;
+	}
+	file << "  ]" << std::endl;
+
+	file << "}" << std::endl;
+
+	// close file stream
+	file.close();
+
+	if (fp.logMed()) {
+		std::cout << "IO> Done" << std::endl << std::endl;
+	}
+}
+
 void IO::writeTempSchedule(FloorPlanner const& fp) {
 	std::ofstream gp_out;
 	std::ofstream data_out;
@@ -2034,8 +2518,14 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 			gp_out << " fillcolor rgb \"#704a30\" fillstyle solid";
 			gp_out << std::endl;
 
-			// label
-			gp_out << "set label \"" << TSV_group.id << "\"";
+			// label; for vertical buses derived from the related alignment
+			// request
+			if (TSV_group.alignment_req != -1) {
+				gp_out << "set label \"" << alignment[TSV_group.alignment_req].busId() << "\"";
+			}
+			else {
+				gp_out << "set label \"" << TSV_group.id << "\"";
+			}
 			gp_out << " at " << TSV_group.bb.ll.x + 0.01 * fp.IC.outline_x;
 			gp_out << "," << TSV_group.bb.ll.y + 0.01 * fp.IC.outline_y;
 			gp_out << " font \"Gill Sans,2\"";
@@ -2058,7 +2548,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 				// related intersection/offset to illustrate block alignment
 				for (CorblivarAlignmentReq const& req :  alignment) {
 
-					if (req.s_i->id == cur_block.id || req.s_j->id == cur_block.id) {
+					if (req.s_i->numerical_id == cur_block.numerical_id || req.s_j->numerical_id == cur_block.numerical_id) {
 
 						// init alignment flags; -1 equals undefined
 						req_x_fulfilled = req_y_fulfilled = -1;
@@ -2537,7 +3027,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 		// TSV densities for each grid bin, given in the power_maps
 		else {
 			// walk power-map grid to obtain specific TSV densities of bins
-			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < fp.thermalAnalyzer.thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
 
 				// adapt index for final thermal map according to padding
 				map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
@@ -2559,11 +3049,11 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 				// upper bound, limit bin dimension according to overall
 				// chip outline; scale down slightly is required to avoid
 				// rounding errors during HotSpot's grid mapping
-				else if (x == (ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
+				else if (x == (fp.thermalAnalyzer.thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
 					bin_w = 0.999 * static_cast<float>(fp.IC.outline_x * Math::SCALE_UM_M - x_ll);
 				}
 
-				for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+				for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < fp.thermalAnalyzer.thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
 					// adapt index for final thermal map according to padding
 					map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
 
@@ -2585,7 +3075,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 					// overall chip outline; scale down slightly is
 					// required to avoid rounding errors during
 					// HotSpot's grid mapping
-					else if (y == (ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
+					else if (y == (fp.thermalAnalyzer.thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
 						bin_h = 0.999 * static_cast<float>(fp.IC.outline_y * Math::SCALE_UM_M - y_ll);
 					}
 
@@ -2598,8 +3088,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 					file << "	" << x_ll;
 					file << "	" << y_ll;
 					// thermal properties, depending on bin's TSV density
-					file << "	" << ThermalAnalyzer::heatCapSi(fp.IC.TSV_group_Cu_Si_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file << "	" << ThermalAnalyzer::thermResSi(fp.IC.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
+					file << "	" << ThermalAnalyzer::heatCapSi(fp.IC.TSV_group_Cu_Si_ratio, fp.thermalAnalyzer.power_maps[cur_layer].TSV_density[x][y]);
+					file << "	" << ThermalAnalyzer::thermResSi(fp.IC.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer].TSV_density[x][y]);
 					file << std::endl;
 
 					// put grid block as floorplan blocks; bonding layer
@@ -2611,8 +3101,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 					file_bond << "	" << x_ll;
 					file_bond << "	" << y_ll;
 					// thermal properties, depending on bin's TSV density
-					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.IC.TSV_group_Cu_Si_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.IC.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
+					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.IC.TSV_group_Cu_Si_ratio, fp.thermalAnalyzer.power_maps[cur_layer].TSV_density[x][y]);
+					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.IC.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer].TSV_density[x][y]);
 					file_bond << std::endl;
 				}
 			}
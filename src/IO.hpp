@@ -38,9 +38,15 @@ class IO {
 
 	// private data, functions
 	private:
-		static constexpr int CONFIG_VERSION = 16;
+		static constexpr int CONFIG_VERSION = 18;
 		static constexpr int TECHNOLOGY_VERSION = 2;
 
+		// parsing of benchmark files into records of the benchmark cache;
+		// only required if records cannot be loaded from cache file
+		static void parseBlocksFiles(FloorPlanner& fp);
+		static void parseNetsFile(FloorPlanner& fp);
+		static void parseAlignmentRequestsFile(FloorPlanner& fp);
+
 	// constructors, destructors, if any non-implicit
 	// private in order to avoid instances of ``static'' class
 	private:
@@ -53,12 +59,15 @@ class IO {
 		static void parseBlocks(FloorPlanner& fp);
 		static void parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments);
 		static void parseNets(FloorPlanner& fp);
+		static void writeBenchmarkCache(FloorPlanner& fp);
 		static void parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb);
+		static bool parseHotSpotThermalMap(FloorPlanner const& fp, std::vector< std::vector<double> >& thermal_map);
 		static void writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignment, std::string const& file_suffix = "");
 		static void writeHotSpotFiles(FloorPlanner const& fp);
 		// non-const reference due to map acces via []
 		static void writeMaps(FloorPlanner& fp);
 		static void writeTempSchedule(FloorPlanner const& fp);
+		static void writePerformanceReport(FloorPlanner const& fp);
 };
 
 #endif
@@ -198,7 +198,7 @@ void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const&
 	// init outermost block w/ first block from non-empty die
 	for (int l = 0; l < this->parameters.layers; l++) {
 
-		if (!corb.getDie(l).getBlocks().empty()) {
+		if (!corb.getDie(l).getCBL().empty()) {
 			outermost_block = corb.getDie(l).getBlock(0);
 			break;
 		}
@@ -210,7 +210,7 @@ void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const&
 		// search among all blocks, consider x-dimension
 		for (int l = 0; l < this->parameters.layers; l++) {
 
-			for (unsigned b = 0; b < corb.getDie(l).getBlocks().size(); b++) {
+			for (unsigned b = 0; b < corb.getDie(l).getCBL().size(); b++) {
 
 				// current block further right?
 				if (corb.getDie(l).getBlock(b)->bb.ur.x > outermost_block->bb.ur.x) {
@@ -229,7 +229,7 @@ void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const&
 			while (true) {
 
 				// randomly consider any block on relevant die die1
-				tuple1 = Math::randI(0, corb.getDie(die1).getBlocks().size());
+				tuple1 = Math::randI(0, corb.getDie(die1).getCBL().size());
 
 				cur_block = corb.getDie(die1).getBlock(tuple1);
 
@@ -247,7 +247,7 @@ void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const&
 		// search among all blocks, consider y-dimension
 		for (int l = 0; l < this->parameters.layers; l++) {
 
-			for (unsigned b = 0; b < corb.getDie(l).getBlocks().size(); b++) {
+			for (unsigned b = 0; b < corb.getDie(l).getCBL().size(); b++) {
 
 				// current block further above?
 				if (corb.getDie(l).getBlock(b)->bb.ur.y > outermost_block->bb.ur.y) {
@@ -267,7 +267,7 @@ void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const&
 			while (true) {
 
 				// randomly consider any block on relevant die die1
-				tuple1 = Math::randI(0, corb.getDie(die1).getBlocks().size());
+				tuple1 = Math::randI(0, corb.getDie(die1).getCBL().size());
 
 				cur_block = corb.getDie(die1).getBlock(tuple1);
 
@@ -308,12 +308,12 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 		// blocks; avoid the dummy reference block if required
 		if (
 			// randomly select s_i if it's not the RBOD
-			(failed_req->s_i->id != RBOD::ID && Math::randB()) ||
+			(failed_req->s_i->numerical_id != RBOD::NUMERICAL_ID && Math::randB()) ||
 			// also consider s_i if s_j is the RBOD
-			failed_req->s_j->id == RBOD::ID
+			failed_req->s_j->numerical_id == RBOD::NUMERICAL_ID
 		   ) {
 			// sanity check for both s_i and s_j being RBOD
-			if (failed_req->s_i->id == RBOD::ID) {
+			if (failed_req->s_i->numerical_id == RBOD::NUMERICAL_ID) {
 				return false;
 			}
 
@@ -335,7 +335,7 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 		tuple1 = corb.getDie(die1).getTuple(b1);
 		// for RBOD being the partner, we assume the same die as for the block to
 		// be changed
-		if (b1_partner->id == RBOD::ID) {
+		if (b1_partner->numerical_id == RBOD::NUMERICAL_ID) {
 			die2 = die1;
 		}
 		else {
@@ -391,13 +391,14 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 
 			while (true) {
 
-				for (Block const* b2 : corb.getDie(die2).getBlocks()) {
+				for (CornerBlockList::Tuple const& tuple : corb.getDie(die2).getCBL().getTuples()) {
+					Block const* b2 = tuple.S;
 
 					// candidate block; overlaps with b1's partner
 					// block
 					if (Rect::rectsIntersect(bb, b2->bb) &&
 						// avoid swapping with b1 itself
-						b1->id != b2->id &&
+						b1->numerical_id != b2->numerical_id &&
 						// also check that blocks are not partner blocks
 						// of the alignment request; otherwise,
 						// consecutively circular swap might occur which
@@ -455,7 +456,8 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 				// determine nearest right block
 				case Block::AlignmentStatus::FAIL_HOR_TOO_LEFT:
 		
-					for (Block const* b2 : corb.getDie(die2).getBlocks()) {
+					for (CornerBlockList::Tuple const& tuple : corb.getDie(die2).getCBL().getTuples()) {
+						Block const* b2 = tuple.S;
 
 						if (Rect::rectA_leftOf_rectB(b1->bb, b2->bb, true) &&
 							// also check that blocks are not partner blocks
@@ -476,7 +478,8 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 				// determine nearest left block
 				case Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT:
 		
-					for (Block const* b2 : corb.getDie(die2).getBlocks()) {
+					for (CornerBlockList::Tuple const& tuple : corb.getDie(die2).getCBL().getTuples()) {
+						Block const* b2 = tuple.S;
 
 						if (Rect::rectA_leftOf_rectB(b2->bb, b1->bb, true) &&
 							// also check that blocks are not partner blocks
@@ -497,7 +500,8 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 				// determine nearest block above
 				case Block::AlignmentStatus::FAIL_VERT_TOO_LOW:
 		
-					for (Block const* b2 : corb.getDie(die2).getBlocks()) {
+					for (CornerBlockList::Tuple const& tuple : corb.getDie(die2).getCBL().getTuples()) {
+						Block const* b2 = tuple.S;
 
 						if (Rect::rectA_below_rectB(b1->bb, b2->bb, true) &&
 							// also check that blocks are not partner blocks
@@ -518,7 +522,8 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 				// determine nearest block below
 				case Block::AlignmentStatus::FAIL_VERT_TOO_HIGH:
 		
-					for (Block const* b2 : corb.getDie(die2).getBlocks()) {
+					for (CornerBlockList::Tuple const& tuple : corb.getDie(die2).getCBL().getTuples()) {
+						Block const* b2 = tuple.S;
 
 						if (Rect::rectA_below_rectB(b2->bb, b1->bb, true) &&
 							// also check that blocks are not partner blocks
@@ -595,7 +600,8 @@ bool LayoutOperations::performOpEnhancedSoftBlockShaping(CorblivarCore const& co
 			// dummy value, to be large than right front
 			boundary_x = 2.0 * shape_block->bb.ur.x;
 
-			for (Block const* b : corb.getDie(shape_block->layer).getBlocks()) {
+			for (CornerBlockList::Tuple const& tuple : corb.getDie(shape_block->layer).getCBL().getTuples()) {
+				Block const* b = tuple.S;
 
 				// determine nearest right front of other blocks
 				if (b->bb.ur.x > shape_block->bb.ur.x) {
@@ -616,7 +622,8 @@ bool LayoutOperations::performOpEnhancedSoftBlockShaping(CorblivarCore const& co
 
 			boundary_x = 0.0;
 
-			for (Block const* b : corb.getDie(shape_block->layer).getBlocks()) {
+			for (CornerBlockList::Tuple const& tuple : corb.getDie(shape_block->layer).getCBL().getTuples()) {
+				Block const* b = tuple.S;
 
 				// determine nearest left front of other blocks
 				if (b->bb.ll.x < shape_block->bb.ur.x) {
@@ -638,7 +645,8 @@ bool LayoutOperations::performOpEnhancedSoftBlockShaping(CorblivarCore const& co
 			// dummy value, to be large than top front
 			boundary_y = 2.0 * shape_block->bb.ur.y;
 
-			for (Block const* b : corb.getDie(shape_block->layer).getBlocks()) {
+			for (CornerBlockList::Tuple const& tuple : corb.getDie(shape_block->layer).getCBL().getTuples()) {
+				Block const* b = tuple.S;
 
 				// determine nearest top front of other blocks
 				if (b->bb.ur.y > shape_block->bb.ur.y) {
@@ -659,7 +667,8 @@ bool LayoutOperations::performOpEnhancedSoftBlockShaping(CorblivarCore const& co
 
 			boundary_y = 0.0;
 
-			for (Block const* b : corb.getDie(shape_block->layer).getBlocks()) {
+			for (CornerBlockList::Tuple const& tuple : corb.getDie(shape_block->layer).getCBL().getTuples()) {
+				Block const* b = tuple.S;
 
 				// determine nearest bottom front of other blocks
 				if (b->bb.ll.y < shape_block->bb.ur.y) {
@@ -695,7 +704,8 @@ bool LayoutOperations::performOpEnhancedHardBlockRotation(CorblivarCore const& c
 		// check blocks in (implicitly constructed) row
 		row_max_height = shape_block->bb.h;
 
-		for (Block const* b : corb.getDie(shape_block->layer).getBlocks()) {
+		for (CornerBlockList::Tuple const& tuple : corb.getDie(shape_block->layer).getCBL().getTuples()) {
+			Block const* b = tuple.S;
 
 			if (shape_block->bb.ll.y == b->bb.ll.y) {
 				row_max_height = std::max(row_max_height, b->bb.h);
@@ -714,7 +724,8 @@ bool LayoutOperations::performOpEnhancedHardBlockRotation(CorblivarCore const& c
 		// check blocks in (implicitly constructed) column
 		col_max_width = shape_block->bb.w;
 
-		for (Block const* b : corb.getDie(shape_block->layer).getBlocks()) {
+		for (CornerBlockList::Tuple const& tuple : corb.getDie(shape_block->layer).getCBL().getTuples()) {
+			Block const* b = tuple.S;
 
 			if (shape_block->bb.ll.x == b->bb.ll.x) {
 				col_max_width = std::max(col_max_width, b->bb.w);
@@ -905,7 +916,7 @@ bool LayoutOperations::performOpMoveOrSwapBlocks(int const& mode, bool const& re
 
 			for (CorblivarAlignmentReq const* req : corb.getDie(die1).getBlock(tuple1)->alignments_vertical_bus) {
 
-				if (req->s_i->id == corb.getDie(die1).getBlock(tuple1)->id) {
+				if (req->s_i->numerical_id == corb.getDie(die1).getBlock(tuple1)->numerical_id) {
 					b2 = req->s_j;
 				}
 				else {
@@ -1046,6 +1057,7 @@ bool LayoutOperations::performOpMoveOrSwapBlocks(int const& mode, bool const& re
 
 bool LayoutOperations::performOpShapeBlock(bool const& revert, CorblivarCore& corb, int& die1, int& tuple1) const {
 	Block const* shape_block;
+	bool ret;
 
 	if (!revert) {
 
@@ -1075,15 +1087,21 @@ bool LayoutOperations::performOpShapeBlock(bool const& revert, CorblivarCore& co
 		// backup current shape
 		shape_block->bb_backup = shape_block->bb;
 
+		// memorize modified tuple for incremental layout generation
+		corb.editDie(die1).markModified(tuple1);
+
+		// remove key of current shape from layout hash
+		corb.hashBlockShape(shape_block);
+
 		// soft blocks: enhanced block shaping
 		if (shape_block->soft) {
 			// enhanced shaping, according to [Chen06]
 			if (this->parameters.enhanced_soft_block_shaping) {
-				return this->performOpEnhancedSoftBlockShaping(corb, shape_block);
+				ret = this->performOpEnhancedSoftBlockShaping(corb, shape_block);
 			}
 			// simple random shaping
 			else {
-				return shape_block->shapeRandomlyByAR();
+				ret = shape_block->shapeRandomlyByAR();
 			}
 		}
 		// hard blocks: simple rotation or enhanced rotation (perform block
@@ -1093,13 +1111,18 @@ bool LayoutOperations::performOpShapeBlock(bool const& revert, CorblivarCore& co
 		else {
 			// enhanced rotation
 			if (this->parameters.enhanced_hard_block_rotation) {
-				return this->performOpEnhancedHardBlockRotation(corb, shape_block);
+				ret = this->performOpEnhancedHardBlockRotation(corb, shape_block);
 			}
 			// simple rotation
 			else {
-				return shape_block->rotate();
+				ret = shape_block->rotate();
 			}
 		}
+
+		// add key of new shape, if any
+		corb.hashBlockShape(shape_block);
+
+		return ret;
 	}
 	// revert last rotation
 	else {
@@ -1108,9 +1131,15 @@ bool LayoutOperations::performOpShapeBlock(bool const& revert, CorblivarCore& co
 				"; die1: " << this->last_op_die1 << "; tuple1: " << this->last_op_tuple1 << std::endl;
 		}
 
-		// revert by restoring backup bb
-		corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb =
-			corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb_backup;
+		shape_block = corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1);
+
+		// revert by restoring backup bb; also update layout hash
+		corb.hashBlockShape(shape_block);
+		shape_block->bb = shape_block->bb_backup;
+		corb.hashBlockShape(shape_block);
+
+		// memorize modified tuple for incremental layout generation
+		corb.editDie(this->last_op_die1).markModified(this->last_op_tuple1);
 	}
 
 	return true;
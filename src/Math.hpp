@@ -43,6 +43,16 @@ class Math {
 
 	// public data, functions
 	public:
+		// random-number generator; one engine per thread such that concurrent
+		// SA replicas draw independent, reproducible sequences w/o locking
+		inline static std::mt19937& randEngine() {
+			static thread_local std::mt19937 engine;
+			return engine;
+		};
+		inline static void initRandomNumberGenerator(unsigned const& seed) {
+			Math::randEngine().seed(seed);
+		};
+
 		// random-number functions
 		// note: range is [min, max)
 		inline static int randI(int const& min, int const& max) {
@@ -50,15 +60,14 @@ class Math {
 				return min;
 			}
 			else {
-				return min + (rand() % (max - min));
+				return min + static_cast<int>(Math::randEngine()() % static_cast<unsigned>(max - min));
 			}
 		};
 		inline static bool randB() {
-			int const r = rand();
-			return (r < (RAND_MAX / 2));
+			return (Math::randEngine()() < (Math::randEngine().max() / 2));
 		};
 		inline static double randF(double const& min, double const& max) {
-			double const r = static_cast<double>(rand()) / RAND_MAX;
+			double const r = static_cast<double>(Math::randEngine()()) / Math::randEngine().max();
 			return r * (max - min) + min;
 		};
 
@@ -94,6 +103,24 @@ class Math {
 			return std::abs(d1 - d2) < precision;
 		};
 
+		// hash function; finalizer of splitmix64, i.e., a bijective mixing of all
+		// bits, such that keys for Zobrist hashing can be derived from encoded
+		// features w/o any tables of random numbers
+		inline static unsigned long long hash64(unsigned long long x) {
+			x ^= x >> 30;
+			x *= 0xbf58476d1ce4e5b9ULL;
+			x ^= x >> 27;
+			x *= 0x94d049bb133111ebULL;
+			x ^= x >> 31;
+			return x;
+		};
+		// bit pattern of double value, for hashing
+		inline static unsigned long long doubleBits(double const& value) {
+			unsigned long long ret;
+			std::memcpy(&ret, &value, sizeof(double));
+			return ret;
+		};
+
 		// factor to scale um downto m;
 		static constexpr double SCALE_UM_M = 1.0e-06;
 };
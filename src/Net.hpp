@@ -53,7 +53,9 @@ class Net {
 		int id;
 		bool hasExternalPin;
 		std::vector<Block const*> blocks;
-		std::vector<TSV_Island const*> TSVs;
+		// TSV islands, referred to by their index in the TSV container of the
+		// floorplanner, which is reset for each layout evaluation
+		std::vector<unsigned> TSVs;
 		std::vector<Pin const*> terminals;
 		mutable int layer_bottom, layer_top;
 		mutable bool clustered;
@@ -81,8 +83,9 @@ class Net {
 		};
 
 
-		inline Rect determBoundingBox(int const& layer, bool const& consider_center = false) const {
+		inline Rect determBoundingBox(int const& layer, std::vector<TSV_Island> const& TSVs, bool const& consider_center = false) const {
 			int i;
+			TSV_Island const* t;
 			std::vector<Rect const*> blocks_to_consider;
 			bool blocks_above_considered;
 			bool TSV_in_layer;
@@ -108,7 +111,8 @@ class Net {
 
 			// TSV for cur_net on this layer
 			TSV_in_layer = false;
-			for (TSV_Island const* t : this->TSVs) {
+			for (unsigned const& TSV_index : this->TSVs) {
+				t = &TSVs[TSV_index];
 
 				// TSVs
 				if (t->layer == layer) {
@@ -177,7 +181,8 @@ class Net {
 			// also consider TSV from layer below; required to estimated routing to the respective landing pad
 			if (layer > 0) {
 
-				for (TSV_Island const* t : this->TSVs) {
+				for (unsigned const& TSV_index : this->TSVs) {
+					t = &TSVs[TSV_index];
 
 					if (t->layer == layer - 1) {
 						blocks_to_consider.push_back(&t->bb);
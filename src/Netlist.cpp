@@ -0,0 +1,299 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar netlist; compressed sparse-row representation of nets
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "Netlist.hpp"
+// vector intrinsics for bounding-box reduction; only for x86 architectures
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+// required Corblivar headers
+#include "Block.hpp"
+#include "Net.hpp"
+
+void Netlist::init(std::vector<Net> const& nets, int const& layers) {
+	unsigned pins;
+
+	this->layers = layers;
+
+	this->offsets.clear();
+	this->blocks.clear();
+	this->pins_offsets.clear();
+
+	// derive CSR of nets' blocks, along w/ offsets of nets' pins
+	pins = 0;
+	for (Net const& net : nets) {
+
+		this->offsets.push_back(this->blocks.size());
+		this->pins_offsets.push_back(pins);
+
+		for (Block const* b : net.blocks) {
+			this->blocks.push_back(b->numerical_id);
+		}
+
+		pins += net.blocks.size() + net.terminals.size();
+	}
+	this->offsets.push_back(this->blocks.size());
+	this->pins_offsets.push_back(pins);
+
+	// allocate buckets and coordinates
+	this->buckets.assign(nets.size() * (layers + 1), 0);
+	this->pins.assign(Netlist::COORDS * pins, 0.0);
+
+	// all buckets are to be determined
+	this->outdated.assign(nets.size(), 1);
+
+	if (Netlist::DBG) {
+		std::cout << "DBG_NETLIST> Nets: " << nets.size() << "; blocks: " << this->blocks.size() << "; pins: " << pins << std::endl;
+	}
+}
+
+void Netlist::bucketPins(unsigned const& n, Net const& net, std::vector<Block> const& blocks) {
+	unsigned b, p;
+	int l;
+	unsigned* bucket;
+	double* coords;
+
+	this->outdated[n] = 0;
+
+	// nets w/o any block; layer boundaries remain undefined, as for
+	// Net::setLayerBoundaries, and no buckets are to be considered
+	if (this->offsets[n] == this->offsets[n + 1]) {
+		return;
+	}
+
+	// buckets of this net; bucket[l] marks the first pin on layer l
+	bucket = &this->buckets[n * (this->layers + 1)];
+
+	// counting sort of net's blocks by their layer; first count blocks per layer,
+	// also determine the layer boundaries
+	std::fill(bucket, bucket + this->layers + 1, 0);
+
+	net.layer_bottom = net.layer_top = blocks[this->blocks[this->offsets[n]]].layer;
+	for (b = this->offsets[n]; b < this->offsets[n + 1]; b++) {
+
+		l = blocks[this->blocks[b]].layer;
+
+		bucket[l + 1]++;
+		net.layer_bottom = std::min(net.layer_bottom, l);
+		net.layer_top = std::max(net.layer_top, l);
+	}
+
+	// terminals have to be routed through die 0, that means when terminals exist
+	// for this net, the lowermost die is die 0
+	if (!net.terminals.empty()) {
+		net.layer_bottom = 0;
+	}
+
+	// derive offsets of buckets
+	bucket[0] = this->pins_offsets[n];
+	for (l = 1; l <= this->layers; l++) {
+		bucket[l] += bucket[l - 1];
+	}
+
+	// store coordinates of blocks into their buckets; the bucket offsets are
+	// shifted along the way, thus they are restored afterwards
+	for (b = this->offsets[n]; b < this->offsets[n + 1]; b++) {
+
+		Block const& block = blocks[this->blocks[b]];
+
+		coords = &this->pins[Netlist::COORDS * bucket[block.layer]++];
+		coords[0] = block.bb.ll.x;
+		coords[1] = block.bb.ll.y;
+		coords[2] = -block.bb.ur.x;
+		coords[3] = -block.bb.ur.y;
+	}
+	for (l = this->layers; l > 0; l--) {
+		bucket[l] = bucket[l - 1];
+	}
+	bucket[0] = this->pins_offsets[n];
+
+	// store coordinates of terminal pins after the last bucket
+	p = bucket[this->layers];
+	for (Pin const* pin : net.terminals) {
+
+		coords = &this->pins[Netlist::COORDS * p++];
+		coords[0] = pin->bb.ll.x;
+		coords[1] = pin->bb.ll.y;
+		coords[2] = -pin->bb.ur.x;
+		coords[3] = -pin->bb.ur.y;
+	}
+}
+
+// one pin's coordinates fit into one AVX register, i.e., the reduction requires one
+// SIMD min operation per pin; note that _mm256_min_pd(a, b) returns (a < b) ? a : b for
+// each element, i.e., it is equal to std::min(b, a)
+void Netlist::reducePins(std::array<double, Netlist::COORDS>& bb, unsigned const& begin, unsigned const& end) const {
+	unsigned p;
+	double const* coords = this->pins.data();
+
+#if defined(__AVX__)
+	__m256d ret = _mm256_loadu_pd(bb.data());
+
+	for (p = begin; p < end; p++) {
+		ret = _mm256_min_pd(_mm256_loadu_pd(coords + Netlist::COORDS * p), ret);
+	}
+
+	_mm256_storeu_pd(bb.data(), ret);
+#else
+	unsigned c;
+
+	for (p = begin; p < end; p++) {
+		for (c = 0; c < Netlist::COORDS; c++) {
+			bb[c] = std::min(bb[c], coords[Netlist::COORDS * p + c]);
+		}
+	}
+#endif
+}
+
+Rect Netlist::determBoundingBox(unsigned const& n, Net const& net, int const& layer, std::vector<TSV_Island> const& TSVs) const {
+	int i;
+	unsigned count;
+	unsigned bucket;
+	bool TSV_in_layer;
+	std::array<double, Netlist::COORDS> bb;
+	// dummy return value
+	Rect ret;
+
+	if (layer < 0 || layer >= this->layers) {
+		return ret;
+	}
+
+	bb.fill(std::numeric_limits<double>::max());
+	bucket = n * (this->layers + 1);
+
+	// blocks for net on this layer
+	count = this->bucketSize(n, layer);
+	this->reducePins(bb, this->buckets[bucket + layer], this->buckets[bucket + layer + 1]);
+
+	// TSV for net on this layer
+	TSV_in_layer = false;
+	for (unsigned const& t : net.TSVs) {
+
+		if (TSVs[t].layer == layer) {
+			Netlist::reduceRect(bb, TSVs[t].bb);
+			count++;
+			TSV_in_layer = true;
+		}
+	}
+
+	// also consider terminal pins; only on lowest die of stack since connections
+	// b/w terminal pins and blocks on upper dies are routed through the TSV in that
+	// lowermost die
+	if (layer == 0) {
+		count += net.terminals.size();
+		this->reducePins(bb, this->buckets[bucket + this->layers], this->pins_offsets[n + 1]);
+	}
+
+	// ignore cases with no blocks on current layer
+	if (count == 0) {
+		return ret;
+	}
+
+	// consider blocks on the next layer above w/ any blocks; required to assume a
+	// reasonable bounding box on current layer w/o actual placement of TSVs; only
+	// required when no TSV is placed yet on this layer
+	if (!TSV_in_layer) {
+
+		for (i = layer + 1; i <= net.layer_top; i++) {
+
+			if (this->bucketSize(n, i) > 0) {
+				count += this->bucketSize(n, i);
+				this->reducePins(bb, this->buckets[bucket + i], this->buckets[bucket + i + 1]);
+
+				break;
+			}
+		}
+	}
+
+	// also consider TSV from layer below; required to estimated routing to the
+	// respective landing pad
+	if (layer > 0) {
+
+		for (unsigned const& t : net.TSVs) {
+
+			if (TSVs[t].layer == layer - 1) {
+				Netlist::reduceRect(bb, TSVs[t].bb);
+				count++;
+			}
+		}
+	}
+
+	// ignore cases where only one block on the uppermost layer needs to be
+	// considered; these cases are already covered while considering layers below
+	if (count == 1 && layer == net.layer_top) {
+		return ret;
+	}
+
+	ret.ll.x = bb[0];
+	ret.ll.y = bb[1];
+	ret.ur.x = -bb[2];
+	ret.ur.y = -bb[3];
+	ret.w = ret.ur.x - ret.ll.x;
+	ret.h = ret.ur.y - ret.ll.y;
+	ret.area = ret.w * ret.h;
+
+	return ret;
+}
+
+Rect Netlist::determCenterBoundingBox(unsigned const& n, Net const& net, std::vector<Block> const& blocks) const {
+	unsigned b;
+	std::array<double, Netlist::COORDS> bb;
+	Rect center;
+	Rect ret;
+
+	// dummy return value, as for Rect::determBoundingBox
+	if (this->offsets[n] == this->offsets[n + 1] && net.terminals.empty()) {
+		ret.ll.x = ret.ll.y = ret.ur.x = ret.ur.y = Point::UNDEF;
+		ret.h = ret.w = ret.area = Point::UNDEF;
+
+		return ret;
+	}
+
+	bb.fill(std::numeric_limits<double>::max());
+
+	// lambda expression; consider center point of rect
+	auto reduceCenter = [&](Rect const& rect) {
+		center.ll.x = center.ur.x = rect.ll.x + rect.w / 2.0;
+		center.ll.y = center.ur.y = rect.ll.y + rect.h / 2.0;
+
+		Netlist::reduceRect(bb, center);
+	};
+
+	for (b = this->offsets[n]; b < this->offsets[n + 1]; b++) {
+		reduceCenter(blocks[this->blocks[b]].bb);
+	}
+	for (Pin const* pin : net.terminals) {
+		reduceCenter(pin->bb);
+	}
+
+	ret.ll.x = bb[0];
+	ret.ll.y = bb[1];
+	ret.ur.x = -bb[2];
+	ret.ur.y = -bb[3];
+	ret.w = ret.ur.x - ret.ll.x;
+	ret.h = ret.ur.y - ret.ll.y;
+	ret.area = ret.w * ret.h;
+
+	return ret;
+}
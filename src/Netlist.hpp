@@ -0,0 +1,113 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar netlist; compressed sparse-row representation of nets
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_NETLIST
+#define _CORBLIVAR_NETLIST
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Rect.hpp"
+// forward declarations, if any
+class Block;
+class TSV_Island;
+class Net;
+
+// Compact representation of the nets, behind the evaluation of interconnects. The
+// nets' blocks are stored in compressed sparse-row (CSR) format, i.e., as one array of
+// block indices along w/ the offsets of each net. Furthermore, the pins of each net,
+// i.e., its blocks and terminal pins, are bucketed by the blocks' current layer and
+// their coordinates are stored contiguously; this way, the bounding box of a net on
+// some layer is determined by a min/max reduction over a contiguous range of
+// coordinates, w/o any allocation or repeated scanning of the net's blocks.
+class Netlist {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		int layers;
+
+		// CSR of nets' blocks; the blocks of net n are blocks[offsets[n]] to
+		// blocks[offsets[n + 1] - 1], given as indices of the floorplanner's
+		// blocks
+		std::vector<unsigned> offsets, blocks;
+
+		// pins of nets; the pins of net n are stored from pins_offsets[n] on,
+		// first the blocks, bucketed by layer, then the terminal pins; the
+		// blocks on layer l are the pins [buckets[n * (layers + 1) + l],
+		// buckets[n * (layers + 1) + l + 1])
+		std::vector<unsigned> pins_offsets, buckets;
+
+		// coordinates of pins, stored as (ll.x, ll.y, -ur.x, -ur.y); the
+		// bounding box of a range of pins is thus determined by one
+		// element-wise min reduction, which maps to SIMD min operations
+		static constexpr unsigned COORDS = 4;
+		std::vector<double> pins;
+
+		// flags whether nets' buckets are outdated, i.e., have to be
+		// re-determined before the next use
+		std::vector<char> outdated;
+
+		// helper; min reduction over the coordinates of pins [begin, end)
+		void reducePins(std::array<double, COORDS>& bb, unsigned const& begin, unsigned const& end) const;
+		// helper; consider rect in min reduction
+		inline static void reduceRect(std::array<double, COORDS>& bb, Rect const& rect) {
+			bb[0] = std::min(bb[0], rect.ll.x);
+			bb[1] = std::min(bb[1], rect.ll.y);
+			bb[2] = std::min(bb[2], -rect.ur.x);
+			bb[3] = std::min(bb[3], -rect.ur.y);
+		};
+		// helper; count of net's blocks on layer
+		inline unsigned bucketSize(unsigned const& net, int const& layer) const {
+			unsigned bucket = net * (this->layers + 1) + layer;
+
+			return this->buckets[bucket + 1] - this->buckets[bucket];
+		};
+
+	// public data, functions
+	public:
+		// build CSR from parsed nets; all nets' buckets are outdated afterwards
+		void init(std::vector<Net> const& nets, int const& layers);
+
+		// (re-)determine buckets and coordinates of net's pins, according to
+		// the current layout; also sets the net's layer boundaries
+		void bucketPins(unsigned const& n, Net const& net, std::vector<Block> const& blocks);
+
+		// bounding box of net on given layer, equal to Net::determBoundingBox;
+		// requires up-to-date buckets
+		Rect determBoundingBox(unsigned const& n, Net const& net, int const& layer, std::vector<TSV_Island> const& TSVs) const;
+
+		// bounding box of center points of all net's blocks and terminal pins
+		Rect determCenterBoundingBox(unsigned const& n, Net const& net, std::vector<Block> const& blocks) const;
+
+		// handler for outdated buckets
+		inline void invalidate(unsigned const& n) {
+			this->outdated[n] = 1;
+		};
+		inline bool isOutdated(unsigned const& n) const {
+			return this->outdated[n];
+		};
+};
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar packing front; segment tree over the coordinates of one
+ *    dimension, tracks the maximal front (e.g., right front) of placed blocks
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "PackingFront.hpp"
+// required Corblivar headers
+
+void PackingFront::init() {
+
+	// unique, sorted coordinates
+	std::sort(this->coords.begin(), this->coords.end());
+	this->coords.erase(std::unique(this->coords.begin(), this->coords.end()), this->coords.end());
+
+	if (this->coords.empty()) {
+		this->intervals = 0;
+	}
+	else {
+		this->intervals = this->coords.size() - 1;
+	}
+
+	// reset all nodes; tree of height log(intervals) requires less than 4 *
+	// intervals nodes, root node has index 1
+	this->front_max.assign(4 * this->intervals + 1, 0.0);
+	this->front_tag.assign(4 * this->intervals + 1, 0.0);
+
+	if (PackingFront::DBG) {
+		std::cout << "DBG_PACKING_FRONT> Init front; elementary intervals: " << this->intervals << std::endl;
+	}
+}
+
+void PackingFront::raise(unsigned const& node, unsigned const& node_lo, unsigned const& node_hi, unsigned const& lo, unsigned const& hi, double const& front) {
+	unsigned node_mid;
+
+	// no overlap of node range and range to raise
+	if (hi <= node_lo || node_hi <= lo) {
+		return;
+	}
+
+	// node range fully covered; memorize front for full range
+	if (lo <= node_lo && node_hi <= hi) {
+		this->front_tag[node] = std::max(this->front_tag[node], front);
+		this->front_max[node] = std::max(this->front_max[node], front);
+
+		return;
+	}
+
+	// partial overlap; raise children
+	node_mid = (node_lo + node_hi) / 2;
+	this->raise(2 * node, node_lo, node_mid, lo, hi, front);
+	this->raise(2 * node + 1, node_mid, node_hi, lo, hi, front);
+
+	// update max front from children
+	this->front_max[node] = std::max(this->front_tag[node], std::max(this->front_max[2 * node], this->front_max[2 * node + 1]));
+}
+
+double PackingFront::max(unsigned const& node, unsigned const& node_lo, unsigned const& node_hi, unsigned const& lo, unsigned const& hi) const {
+	unsigned node_mid;
+
+	// no overlap of node range and range to query
+	if (hi <= node_lo || node_hi <= lo) {
+		return 0.0;
+	}
+
+	// node range fully covered
+	if (lo <= node_lo && node_hi <= hi) {
+		return this->front_max[node];
+	}
+
+	// partial overlap; consider front of full node range and children
+	node_mid = (node_lo + node_hi) / 2;
+
+	return std::max(this->front_tag[node], std::max(
+				this->max(2 * node, node_lo, node_mid, lo, hi),
+				this->max(2 * node + 1, node_mid, node_hi, lo, hi)
+			));
+}
@@ -0,0 +1,87 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar packing front; segment tree over the coordinates of one
+ *    dimension, tracks the maximal front (e.g., right front) of placed blocks
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_PACKING_FRONT
+#define _CORBLIVAR_PACKING_FRONT
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+class PackingFront {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		// (sorted, unique) coordinates; elementary intervals [coords[i], coords[i + 1])
+		// are the leaves of the tree
+		std::vector<double> coords;
+
+		// segment-tree nodes; front_max holds the maximal front within the
+		// node's range, front_tag the front raised for the node's full range
+		std::vector<double> front_max, front_tag;
+
+		// number of elementary intervals
+		unsigned intervals;
+
+		// recursive handlers; node ranges are given as [node_lo, node_hi)
+		void raise(unsigned const& node, unsigned const& node_lo, unsigned const& node_hi, unsigned const& lo, unsigned const& hi, double const& front);
+		double max(unsigned const& node, unsigned const& node_lo, unsigned const& node_hi, unsigned const& lo, unsigned const& hi) const;
+
+	// public data, functions
+	public:
+		// init front, all elementary intervals are set to zero front; the
+		// coordinates are to be pushed into editCoords() beforehand
+		inline std::vector<double>& editCoords() {
+			return this->coords;
+		};
+		void init();
+
+		// index of coordinate, i.e., of elementary interval starting at
+		// coordinate; coordinate must be previously pushed
+		inline unsigned index(double const& coord) const {
+			return std::lower_bound(this->coords.begin(), this->coords.end(), coord) - this->coords.begin();
+		};
+
+		// raise front to (at least) given value, for elementary intervals [lo, hi)
+		inline void raise(unsigned const& lo, unsigned const& hi, double const& front) {
+			if (lo < hi) {
+				this->raise(1, 0, this->intervals, lo, hi, front);
+			}
+		};
+
+		// maximal front for elementary intervals [lo, hi); zero for empty range
+		inline double max(unsigned const& lo, unsigned const& hi) const {
+			if (lo < hi) {
+				return this->max(1, 0, this->intervals, lo, hi);
+			}
+			else {
+				return 0.0;
+			}
+		};
+};
+
+#endif
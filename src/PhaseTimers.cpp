@@ -0,0 +1,242 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar phase timers; low-overhead profiling of SA hot paths
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "PhaseTimers.hpp"
+// required Corblivar headers
+
+// memory allocation
+constexpr std::array<char const*, PhaseTimers::PHASES> PhaseTimers::PHASE_NAMES;
+constexpr std::array<char const*, PhaseTimers::SA_PHASES> PhaseTimers::SA_PHASE_NAMES;
+std::vector< std::unique_ptr<PhaseTimers::Tallies> > PhaseTimers::registry;
+std::mutex PhaseTimers::registry_mutex;
+thread_local PhaseTimers::Tallies* PhaseTimers::tallies = nullptr;
+
+PhaseTimers::Tallies& PhaseTimers::threadTallies() {
+
+	if (PhaseTimers::tallies == nullptr) {
+		std::lock_guard<std::mutex> lock(PhaseTimers::registry_mutex);
+
+		// value-initialization, i.e., all tallies are zero
+		PhaseTimers::registry.emplace_back(new Tallies());
+		PhaseTimers::tallies = PhaseTimers::registry.back().get();
+	}
+
+	return *PhaseTimers::tallies;
+}
+
+void PhaseTimers::record(Phase const& phase, Clock::time_point const& start) {
+	double ns;
+
+	ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+	PhaseTally& tally = PhaseTimers::threadTallies().phases[phase];
+	tally.calls++;
+	tally.total_ns += ns;
+	tally.histogram[PhaseTimers::histogramBin(ns)]++;
+}
+
+void PhaseTimers::recordOps(SAPhase const& phase, unsigned long const& ops, Clock::time_point const& start) {
+
+	if (!PhaseTimers::PROFILE) {
+		return;
+	}
+
+	SAPhaseTally& tally = PhaseTimers::threadTallies().SA_phases[phase];
+	tally.ops += ops;
+	tally.total_ns += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+void PhaseTimers::recordCacheLookup(SAPhase const& phase, bool const& hit, double const& time_saved) {
+
+	if (!PhaseTimers::PROFILE) {
+		return;
+	}
+
+	CacheTally& tally = PhaseTimers::threadTallies().cache[phase];
+	tally.lookups++;
+	if (hit) {
+		tally.hits++;
+		tally.saved_ns += time_saved;
+	}
+}
+
+double PhaseTimers::elapsed(Clock::time_point const& start) {
+
+	if (!PhaseTimers::PROFILE) {
+		return 0.0;
+	}
+
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// bins are determined by the binary exponent and the leading mantissa bits, i.e., w/o
+// any logarithm
+unsigned PhaseTimers::histogramBin(double const& ns) {
+	int exp;
+	double mantissa;
+	unsigned octave, sub_bin;
+
+	if (ns < 1.0) {
+		return 0;
+	}
+
+	// ns = mantissa * 2^exp, w/ mantissa in [0.5, 1)
+	mantissa = std::frexp(ns, &exp);
+
+	octave = exp - 1;
+	if (octave >= PhaseTimers::HISTOGRAM_OCTAVES) {
+		return PhaseTimers::HISTOGRAM_BINS - 1;
+	}
+	sub_bin = static_cast<unsigned>((2.0 * mantissa - 1.0) * PhaseTimers::HISTOGRAM_SUB_BINS);
+
+	return octave * PhaseTimers::HISTOGRAM_SUB_BINS + sub_bin;
+}
+
+double PhaseTimers::histogramBinUpperBound(unsigned const& bin) {
+	unsigned octave, sub_bin;
+
+	octave = bin / PhaseTimers::HISTOGRAM_SUB_BINS;
+	sub_bin = bin % PhaseTimers::HISTOGRAM_SUB_BINS;
+
+	return std::ldexp(1.0 + static_cast<double>(sub_bin + 1) / PhaseTimers::HISTOGRAM_SUB_BINS, octave);
+}
+
+std::vector<PhaseTimers::PhaseStats> PhaseTimers::mergedPhaseStats() {
+	std::vector<PhaseStats> ret;
+	PhaseTally merged;
+	unsigned long p99_rank, calls;
+	unsigned b;
+
+	std::lock_guard<std::mutex> lock(PhaseTimers::registry_mutex);
+
+	for (unsigned p = 0; p < PhaseTimers::PHASES; p++) {
+
+		// merge tallies of all threads
+		merged.calls = 0;
+		merged.total_ns = 0.0;
+		merged.histogram.fill(0);
+
+		for (std::unique_ptr<Tallies> const& tallies : PhaseTimers::registry) {
+
+			PhaseTally const& tally = tallies->phases[p];
+
+			merged.calls += tally.calls;
+			merged.total_ns += tally.total_ns;
+			for (b = 0; b < PhaseTimers::HISTOGRAM_BINS; b++) {
+				merged.histogram[b] += tally.histogram[b];
+			}
+		}
+
+		PhaseStats stats;
+		stats.name = PhaseTimers::PHASE_NAMES[p];
+		stats.calls = merged.calls;
+		stats.total = merged.total_ns * 1.0e-9;
+		stats.mean = stats.p99 = 0.0;
+
+		if (merged.calls > 0) {
+			stats.mean = stats.total / merged.calls;
+
+			// 99th percentile; upper bound of the bin covering the related
+			// rank
+			p99_rank = static_cast<unsigned long>(std::ceil(0.99 * merged.calls));
+			calls = 0;
+			for (b = 0; b < PhaseTimers::HISTOGRAM_BINS; b++) {
+				calls += merged.histogram[b];
+				if (calls >= p99_rank) {
+					break;
+				}
+			}
+			stats.p99 = PhaseTimers::histogramBinUpperBound(b) * 1.0e-9;
+		}
+
+		ret.push_back(stats);
+	}
+
+	return ret;
+}
+
+std::vector<PhaseTimers::SAPhaseStats> PhaseTimers::mergedSAPhaseStats() {
+	std::vector<SAPhaseStats> ret;
+
+	std::lock_guard<std::mutex> lock(PhaseTimers::registry_mutex);
+
+	for (unsigned p = 0; p < PhaseTimers::SA_PHASES; p++) {
+
+		SAPhaseStats stats;
+		stats.name = PhaseTimers::SA_PHASE_NAMES[p];
+		stats.ops = 0;
+		stats.time = 0.0;
+
+		// merge tallies of all threads; note that the time is thus summed up
+		// over concurrently running replicas as well, i.e., the ops rate
+		// refers to one annealing chain
+		for (std::unique_ptr<Tallies> const& tallies : PhaseTimers::registry) {
+			stats.ops += tallies->SA_phases[p].ops;
+			stats.time += tallies->SA_phases[p].total_ns * 1.0e-9;
+		}
+
+		if (stats.time > 0.0) {
+			stats.ops_per_sec = stats.ops / stats.time;
+		}
+		else {
+			stats.ops_per_sec = 0.0;
+		}
+
+		ret.push_back(stats);
+	}
+
+	return ret;
+}
+
+std::vector<PhaseTimers::CacheStats> PhaseTimers::mergedCacheStats() {
+	std::vector<CacheStats> ret;
+
+	std::lock_guard<std::mutex> lock(PhaseTimers::registry_mutex);
+
+	// the cache is consulted only during SA phases I and II, not during sampling
+	for (unsigned p = SA_PHASE_ONE; p < PhaseTimers::SA_PHASES; p++) {
+
+		CacheStats stats;
+		stats.name = PhaseTimers::SA_PHASE_NAMES[p];
+		stats.lookups = stats.hits = 0;
+		stats.time_saved = 0.0;
+
+		for (std::unique_ptr<Tallies> const& tallies : PhaseTimers::registry) {
+			stats.lookups += tallies->cache[p].lookups;
+			stats.hits += tallies->cache[p].hits;
+			stats.time_saved += tallies->cache[p].saved_ns * 1.0e-9;
+		}
+
+		if (stats.lookups > 0) {
+			stats.hit_rate = static_cast<double>(stats.hits) / stats.lookups;
+		}
+		else {
+			stats.hit_rate = 0.0;
+		}
+
+		ret.push_back(stats);
+	}
+
+	return ret;
+}
@@ -0,0 +1,198 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar phase timers; low-overhead profiling of SA hot paths
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_PHASETIMERS
+#define _CORBLIVAR_PHASETIMERS
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+// timers for the hot paths of layout generation and evaluation, and tracking of
+// layout operations per SA phase; all tallies are held per thread, thus concurrently
+// running replicas don't contend for them, and are only merged for the report
+class PhaseTimers {
+	// profiling code switch (public); w/o this switch, all timers are compiled out
+	public:
+		static constexpr bool PROFILE = true;
+
+	// public data, functions
+	public:
+		// timed phases; the times are inclusive, i.e., nested phases like
+		// performPacking are also covered by the time of generateLayout
+		enum Phase : unsigned {
+			GENERATE_LAYOUT,
+			PERFORM_PACKING,
+			ALIGN_BLOCKS,
+			UPDATE_BLOCKS_GEOMETRY,
+			EVALUATE_AREA_OUTLINE,
+			EVALUATE_INTERCONNECTS,
+			CLUSTER_SIGNAL_TSVS,
+			EVALUATE_ALIGNMENTS,
+			GENERATE_POWER_MAPS,
+			PERFORM_POWER_BLURRING,
+			PHASES
+		};
+		static constexpr std::array<char const*, PHASES> PHASE_NAMES {{
+			"generateLayout",
+			"performPacking",
+			"alignBlocks",
+			"updateBlocksGeometry",
+			"evaluateAreaOutline",
+			"evaluateInterconnects",
+			"clusterSignalTSVs",
+			"evaluateAlignments",
+			"generatePowerMaps",
+			"performPowerBlurring"
+		}};
+
+		// SA phases for tracking of layout operations; initial solution-space
+		// sampling, phase I (packing into outline), and phase II (optimizing
+		// within outline)
+		enum SAPhase : unsigned {
+			SA_SAMPLING,
+			SA_PHASE_ONE,
+			SA_PHASE_TWO,
+			SA_PHASES
+		};
+		static constexpr std::array<char const*, SA_PHASES> SA_PHASE_NAMES {{
+			"sampling",
+			"phase_one",
+			"phase_two"
+		}};
+
+		typedef std::chrono::steady_clock Clock;
+
+		// scoped timer; records its lifetime for the given phase
+		class Scope {
+			private:
+				Phase const phase;
+				Clock::time_point start;
+
+			public:
+				explicit Scope(Phase const& phase) : phase(phase) {
+					if (PhaseTimers::PROFILE) {
+						this->start = Clock::now();
+					}
+				}
+				~Scope() {
+					if (PhaseTimers::PROFILE) {
+						PhaseTimers::record(this->phase, this->start);
+					}
+				}
+		};
+
+		// merged stats of all threads; POD declarations
+		struct PhaseStats {
+			char const* name;
+			unsigned long calls;
+			// all times in seconds
+			double total, mean, p99;
+		};
+		struct SAPhaseStats {
+			char const* name;
+			unsigned long ops;
+			double time;
+			double ops_per_sec;
+		};
+		struct CacheStats {
+			char const* name;
+			unsigned long lookups, hits;
+			double hit_rate;
+			// time of layout generation and evaluation saved by hits, in
+			// seconds; only rejected hits save time, accepted hits are
+			// evaluated again
+			double time_saved;
+		};
+
+		// timestamp; only taken if profiling is active
+		inline static Clock::time_point now() {
+			if (PhaseTimers::PROFILE) {
+				return Clock::now();
+			}
+			else {
+				return Clock::time_point();
+			}
+		};
+
+		static void record(Phase const& phase, Clock::time_point const& start);
+		static void recordOps(SAPhase const& phase, unsigned long const& ops, Clock::time_point const& start);
+		static void recordCacheLookup(SAPhase const& phase, bool const& hit, double const& time_saved);
+
+		// elapsed time since start, in ns; zero if profiling is not active
+		static double elapsed(Clock::time_point const& start);
+
+		static std::vector<PhaseStats> mergedPhaseStats();
+		static std::vector<SAPhaseStats> mergedSAPhaseStats();
+		static std::vector<CacheStats> mergedCacheStats();
+
+	// private data, functions
+	private:
+		// histograms of durations, required for percentiles; log-scaled bins,
+		// i.e., octaves of nanoseconds, which are further subdivided linearly;
+		// percentiles are thus resolved up to 1 / HISTOGRAM_SUB_BINS of an
+		// octave
+		static constexpr unsigned HISTOGRAM_SUB_BINS = 8;
+		static constexpr unsigned HISTOGRAM_OCTAVES = 48;
+		static constexpr unsigned HISTOGRAM_BINS = HISTOGRAM_SUB_BINS * HISTOGRAM_OCTAVES;
+
+		static unsigned histogramBin(double const& ns);
+		static double histogramBinUpperBound(unsigned const& bin);
+
+		// tallies; POD declarations
+		struct PhaseTally {
+			unsigned long calls;
+			double total_ns;
+			std::array<unsigned long, HISTOGRAM_BINS> histogram;
+		};
+		struct SAPhaseTally {
+			unsigned long ops;
+			double total_ns;
+		};
+		struct CacheTally {
+			unsigned long lookups, hits;
+			double saved_ns;
+		};
+		struct Tallies {
+			std::array<PhaseTally, PHASES> phases;
+			std::array<SAPhaseTally, SA_PHASES> SA_phases;
+			std::array<CacheTally, SA_PHASES> cache;
+		};
+
+		// tallies of all threads; owned here such that they outlive their
+		// threads, e.g., the workers of temporary thread pools
+		static std::vector< std::unique_ptr<Tallies> > registry;
+		static std::mutex registry_mutex;
+
+		// tallies of current thread, allocated on first record
+		static thread_local Tallies* tallies;
+		static Tallies& threadTallies();
+
+	// constructors, destructors, if any non-implicit
+	// private in order to avoid instances of ``static'' class
+	private:
+		PhaseTimers() {
+		}
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar placement stack; contiguous, allocation-free (once
+ *    reserved) replacement for list-based stacks Hi, Vi
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_PLACEMENT_STACK
+#define _CORBLIVAR_PLACEMENT_STACK
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+class Block;
+
+class PlacementStack {
+	// private data, functions
+	private:
+		// stack elements; the top of the stack is the last element, such that
+		// push and pop operations do not move any elements
+		std::vector<Block const*> blocks;
+
+		// logical access, i.e., index 0 refers to top of stack
+		inline Block const*& at(unsigned const& index) {
+			return this->blocks[this->blocks.size() - 1 - index];
+		};
+
+	// public data, functions
+	public:
+		// iterators; walk stack from top to bottom
+		typedef std::vector<Block const*>::const_reverse_iterator const_iterator;
+
+		inline const_iterator begin() const {
+			return this->blocks.rbegin();
+		};
+		inline const_iterator end() const {
+			return this->blocks.rend();
+		};
+
+		// memory handlers; reserved memory is retained on clear and assignment
+		inline void reserve(unsigned const& size) {
+			this->blocks.reserve(size);
+		};
+		inline void clear() {
+			this->blocks.clear();
+		};
+
+		// getter
+		inline bool empty() const {
+			return this->blocks.empty();
+		};
+		inline unsigned size() const {
+			return this->blocks.size();
+		};
+		// note that nullptr is returned for empty stacks, which simplifies
+		// comparisons of top blocks of different stacks
+		inline Block const* top() const {
+			if (this->blocks.empty()) {
+				return nullptr;
+			}
+			else {
+				return this->blocks.back();
+			}
+		};
+
+		// stack operations
+		inline void push(Block const* block) {
+			this->blocks.push_back(block);
+		};
+		inline void pop() {
+			this->blocks.pop_back();
+		};
+		inline void pushBottom(Block const* block) {
+			this->blocks.insert(this->blocks.begin(), block);
+		};
+
+		// drop all blocks for which the predicate holds, retains order of other
+		// blocks
+		template<typename Predicate>
+		inline void removeIf(Predicate pred) {
+			this->blocks.erase(std::remove_if(this->blocks.begin(), this->blocks.end(), pred), this->blocks.end());
+		};
+
+		// stable insertion sort, from top to bottom; i.e., block b1 is put on
+		// top of block b2 if comp(b1, b2) holds; stacks are small, and this
+		// sort does not require any temporary memory, as opposed to
+		// std::stable_sort
+		template<typename Compare>
+		inline void sort(Compare comp) {
+			Block const* cur;
+			unsigned i, j;
+
+			for (i = 1; i < this->blocks.size(); i++) {
+
+				cur = this->at(i);
+
+				for (j = i; j > 0 && comp(cur, this->at(j - 1)); j--) {
+					this->at(j) = this->at(j - 1);
+				}
+
+				this->at(j) = cur;
+			}
+		};
+};
+
+#endif
@@ -29,24 +29,22 @@
 #include "Block.hpp"
 #include "Math.hpp"
 
-// memory allocation
-constexpr int RoutingUtilization::UTIL_MAPS_DIM;
-
 void RoutingUtilization::resetUtilMaps(int const& layers) {
 	int i;
 	RoutingUtilization::UtilBin init_bin;
 
-	// reset the maps w/ zero values
+	// reset the maps and difference arrays w/ zero values
 	init_bin.utilization = 0.0;
 	for (i = 0; i < layers; i++) {
 		for (auto& partial_map : this->util_maps[i]) {
-			partial_map.fill(init_bin);
+			std::fill(partial_map.begin(), partial_map.end(), init_bin);
 		}
+		std::fill(this->util_diff[i].begin(), this->util_diff[i].end(), 0.0);
 	}
 }
 
 void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outline) {
-	unsigned b;
+	int b;
 	int i;
 
 	if (RoutingUtilization::DBG_CALLS) {
@@ -54,28 +52,35 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	}
 
 	this->util_maps.clear();
+	this->util_diff.clear();
 
-	// allocate util-maps arrays
+	// allocate util-maps arrays and difference arrays
 	for (i = 0; i < layers; i++) {
 		this->util_maps.emplace_back(
-			std::array<std::array<RoutingUtilization::UtilBin, RoutingUtilization::UTIL_MAPS_DIM>, RoutingUtilization::UTIL_MAPS_DIM>()
+			std::vector< std::vector<RoutingUtilization::UtilBin> >(this->util_maps_dim, std::vector<RoutingUtilization::UtilBin>(this->util_maps_dim))
+		);
+		this->util_diff.emplace_back(
+			std::vector<double>((this->util_maps_dim + 1) * (this->util_maps_dim + 1))
 		);
 	}
+	this->row_sums.resize(this->util_maps_dim);
 
 	// init maps w/ zero values
 	this->resetUtilMaps(layers);
 
 	// scale of util map dimensions
-	this->util_maps_dim_x = die_outline.x / RoutingUtilization::UTIL_MAPS_DIM;
-	this->util_maps_dim_y = die_outline.y / RoutingUtilization::UTIL_MAPS_DIM;
+	this->util_maps_dim_x = die_outline.x / this->util_maps_dim;
+	this->util_maps_dim_y = die_outline.y / this->util_maps_dim;
 
 	// predetermine map bins' area and lower-left corner coordinates; note that the
 	// last bin represents the upper-right coordinates for the penultimate bin
 	this->util_maps_bin_area = this->util_maps_dim_x * this->util_maps_dim_y;
-	for (b = 0; b <= RoutingUtilization::UTIL_MAPS_DIM; b++) {
+	this->util_maps_bins_ll_x.resize(this->util_maps_dim + 1);
+	this->util_maps_bins_ll_y.resize(this->util_maps_dim + 1);
+	for (b = 0; b <= this->util_maps_dim; b++) {
 		this->util_maps_bins_ll_x[b] = b * this->util_maps_dim_x;
 	}
-	for (b = 0; b <= RoutingUtilization::UTIL_MAPS_DIM; b++) {
+	for (b = 0; b <= this->util_maps_dim; b++) {
 		this->util_maps_bins_ll_y[b] = b * this->util_maps_dim_y;
 	}
 
@@ -84,31 +89,80 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	}
 }
 
-RoutingUtilization::UtilResult RoutingUtilization::determCost() const {
-	unsigned x, y;
+RoutingUtilization::UtilResult RoutingUtilization::determCost() {
+	int x, y;
 	unsigned layer;
+	int stride;
+	double row_max, row_sum;
+	double layer_max, residue;
 	UtilResult ret;
 
 	ret.cost = ret.avg_util = ret.max_util = 0.0;
 
+	stride = this->util_maps_dim + 1;
+
 	for (layer = 0; layer < this->util_maps.size(); layer++) {
-		for (x = 0; x < this->util_maps[0].size(); x++) {
-			for (y = 0; y < this->util_maps[0][0].size(); y++) {
 
-				// determine max util
-				if (this->util_maps[layer][x][y].utilization > ret.max_util) {
-					ret.max_util = this->util_maps[layer][x][y].utilization;
+		std::vector<double> const& diff = this->util_diff[layer];
+		std::vector< std::vector<UtilBin> >& map = this->util_maps[layer];
+
+		layer_max = 0.0;
+
+		for (x = 0; x < this->util_maps_dim; x++) {
+
+			// prefix sums along y-dimension, i.e., partial sums of the
+			// difference array's row
+			this->row_sums[0] = diff[x * stride];
+			for (y = 1; y < this->util_maps_dim; y++) {
+				this->row_sums[y] = this->row_sums[y - 1] + diff[x * stride + y];
+			}
+
+			// prefix sums along x-dimension, i.e., add up w/ previous row;
+			// this provides the actual utilization
+			for (y = 0; y < this->util_maps_dim; y++) {
+
+				if (x > 0) {
+					map[x][y].utilization = map[x - 1][y].utilization + this->row_sums[y];
+				}
+				else {
+					map[x][y].utilization = this->row_sums[y];
+				}
+
+				layer_max = std::max(layer_max, std::abs(map[x][y].utilization));
+			}
+		}
+
+		// the marked corners of all nets cancel out outside of the nets' bbs
+		// only up to rounding errors; such residue, relative to the layer's max
+		// utilization, is snapped to zero, and any remaining negative values are
+		// clamped; max and sum of utilization are determined on the fly
+		residue = layer_max * RoutingUtilization::UTIL_RESIDUE_EPSILON;
+
+		for (x = 0; x < this->util_maps_dim; x++) {
+
+			row_max = row_sum = 0.0;
+			for (y = 0; y < this->util_maps_dim; y++) {
+
+				if (std::abs(map[x][y].utilization) < residue) {
+					map[x][y].utilization = 0.0;
+				}
+				else {
+					map[x][y].utilization = std::max(0.0, map[x][y].utilization);
 				}
 
-				// sum up util, required for avg util
-				ret.avg_util += this->util_maps[layer][x][y].utilization;
+				row_max = std::max(row_max, map[x][y].utilization);
+				row_sum += map[x][y].utilization;
 			}
+
+			ret.max_util = std::max(ret.max_util, row_max);
+			// sum up util, required for avg util
+			ret.avg_util += row_sum;
 		}
 	}
 
 	ret.avg_util /= this->util_maps.size();
-	ret.avg_util /= this->util_maps[0].size();
-	ret.avg_util /= this->util_maps[0][0].size();
+	ret.avg_util /= this->util_maps_dim;
+	ret.avg_util /= this->util_maps_dim;
 
 	// cost: avg and max util
 	ret.cost = ret.avg_util * ret.max_util;
@@ -117,7 +171,7 @@ RoutingUtilization::UtilResult RoutingUtilization::determCost() const {
 }
 
 void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, double const& net_weight) {
-	int x, y;
+	int stride;
 	double util;
 	int x_lower, x_upper, y_lower, y_upper;
 	Rect bb_ext;
@@ -129,12 +183,16 @@ void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, doub
 	// determine index boundaries for utilization map; based on intersection of map and
 	// net's bb; note that cast to int truncates toward zero, i.e., performs like
 	// floor for positive numbers
-	x_lower = static_cast<int>(net_bb.ll.x / this->util_maps_dim_x);
-	y_lower = static_cast<int>(net_bb.ll.y / this->util_maps_dim_y);
+	//
+	// limit lower bound to util-maps dimensions as well; nets' bbs may reside
+	// at, or even beyond, the upper/right die outline, e.g., for blocks
+	// exceeding the outline during SA; such bbs are mapped to the last bins
+	x_lower = std::min(static_cast<int>(net_bb.ll.x / this->util_maps_dim_x), this->util_maps_dim - 1);
+	y_lower = std::min(static_cast<int>(net_bb.ll.y / this->util_maps_dim_y), this->util_maps_dim - 1);
 	// +1 in order to efficiently emulate the result of ceil(); limit upper
 	// bound to util-maps dimensions
-	x_upper = std::min(static_cast<int>(net_bb.ur.x / this->util_maps_dim_x) + 1, RoutingUtilization::UTIL_MAPS_DIM);
-	y_upper = std::min(static_cast<int>(net_bb.ur.y / this->util_maps_dim_y) + 1, RoutingUtilization::UTIL_MAPS_DIM);
+	x_upper = std::min(static_cast<int>(net_bb.ur.x / this->util_maps_dim_x) + 1, this->util_maps_dim);
+	y_upper = std::min(static_cast<int>(net_bb.ur.y / this->util_maps_dim_y) + 1, this->util_maps_dim);
 
 	if (RoutingUtilization::DBG) {
 		std::cout << "DBG_ROUTING_UTIL>  Affected util-map bins: " << x_lower << "," << y_lower
@@ -154,16 +212,16 @@ void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, doub
 
 	util = net_weight * ((bb_ext.w + bb_ext.h) / bb_ext.area);
 
-	// walk util-map bins covering intersection; adapt routing utilization
-	for (x = x_lower; x < x_upper; x++) {
-		for (y = y_lower; y < y_upper; y++) {
-
-			// adapt map on affected layer
-			this->util_maps[layer][x][y].utilization += util;
-		}
-	}
+	// adapt difference array on affected layer, i.e., mark the corners of the
+	// util-map bins covering the intersection; the map itself is derived in
+	// determCost
+	stride = this->util_maps_dim + 1;
+	this->util_diff[layer][x_lower * stride + y_lower] += util;
+	this->util_diff[layer][x_upper * stride + y_lower] -= util;
+	this->util_diff[layer][x_lower * stride + y_upper] -= util;
+	this->util_diff[layer][x_upper * stride + y_upper] += util;
 
 	if (RoutingUtilization::DBG_CALLS) {
-		std::cout << "<- RoutingUtilization::adaptPowerMaps" << std::endl;
+		std::cout << "<- RoutingUtilization::adaptUtilMap" << std::endl;
 	}
 }
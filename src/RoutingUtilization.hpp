@@ -39,9 +39,14 @@ class RoutingUtilization {
 	// public data
 	public:
 
-		// dimensions for routing-utilization map
+		// default dimensions for routing-utilization map; the actual dimensions
+		// are configurable, see util_maps_dim
 		static constexpr int UTIL_MAPS_DIM = 64;
 
+		// relative limit for rounding residue of prefix sums, w.r.t. a layer's
+		// max utilization; smaller values are considered as zero
+		static constexpr double UTIL_RESIDUE_EPSILON = 1.0e-9;
+
 	// PODs, to be declared early on
 	public:
 		struct UtilBin {
@@ -56,13 +61,24 @@ class RoutingUtilization {
 	// private data, functions
 	private:
 
-		// utilization maps [i][x][y] whereas i relates to the layer
-		std::vector< std::array< std::array<UtilBin, UTIL_MAPS_DIM>, UTIL_MAPS_DIM> > util_maps;
+		// utilization maps [i][x][y] whereas i relates to the layer; derived
+		// from the difference arrays by determCost
+		std::vector< std::vector< std::vector<UtilBin> > > util_maps;
+
+		// difference arrays [i][x * (util_maps_dim + 1) + y]; each net's
+		// utilization is uniform over its bins, thus only the corners of the
+		// related rectangle are marked in the arrays
+		std::vector< std::vector<double> > util_diff;
+		// helper for prefix sums, i.e., partial sums of current row of bins
+		std::vector<double> row_sums;
+
+		// dimensions, i.e., bins in x- and y-dimension
+		int util_maps_dim = UTIL_MAPS_DIM;
 
 		// parameters for generating utilization maps
 		double util_maps_dim_x, util_maps_dim_y;
 		double util_maps_bin_area;
-		std::array<double, UTIL_MAPS_DIM + 1> util_maps_bins_ll_x, util_maps_bins_ll_y;
+		std::vector<double> util_maps_bins_ll_x, util_maps_bins_ll_y;
 
 
 	// constructors, destructors, if any non-implicit
@@ -72,11 +88,21 @@ class RoutingUtilization {
 	public:
 		friend class IO;
 
+		// setter; map dimension to be set before any init handler is called
+		inline void setUtilMapsDim(int const& dim) {
+			this->util_maps_dim = dim;
+		};
+		// getter
+		inline int const& getUtilMapsDim() const {
+			return this->util_maps_dim;
+		};
+
 		// utilization analysis: handlers
 		void initUtilMaps(int const& layers, Point const& die_outline);
 		void resetUtilMaps(int const& layers);
 		void adaptUtilMap(int const& layer, Rect const& net_bb, double const& net_weight = 1.0);
-		UtilResult determCost() const;
+		// derives the utilization maps and determines the cost in one pass
+		UtilResult determCost();
 };
 
 #endif
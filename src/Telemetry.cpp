@@ -0,0 +1,238 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar streaming of SA telemetry as JSON lines
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "Telemetry.hpp"
+// POSIX file handling and signal masking
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+// required Corblivar headers
+
+// memory allocation
+constexpr unsigned Telemetry::MAX_PENDING_RECORDS;
+constexpr unsigned Telemetry::OPEN_RETRY_INTERVAL_MS;
+
+Telemetry::Telemetry(std::string const& sink) {
+
+	this->sink = sink;
+	this->dropped = 0;
+	this->shutdown = false;
+
+	this->records.reserve(Telemetry::MAX_PENDING_RECORDS);
+
+	this->writer = std::thread(&Telemetry::write, this);
+}
+
+Telemetry::~Telemetry() {
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->shutdown = true;
+	}
+	this->records_available.notify_all();
+
+	this->writer.join();
+
+	if (this->dropped > 0) {
+		std::cout << "Telemetry> " << this->dropped << " records were dropped, since the sink " << this->sink << " didn't keep up" << std::endl;
+	}
+}
+
+void Telemetry::record(Telemetry::Record const& record) {
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->records.size() < Telemetry::MAX_PENDING_RECORDS) {
+			this->records.push_back(record);
+		}
+		else {
+			this->dropped++;
+		}
+	}
+	this->records_available.notify_one();
+}
+
+int Telemetry::open() {
+	int fd;
+	int flags;
+	std::unique_lock<std::mutex> lock(this->mutex);
+
+	while (!this->shutdown) {
+
+		// open w/o blocking; for a FIFO w/o reader, this fails w/ ENXIO
+		fd = ::open(this->sink.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_NONBLOCK, 0644);
+
+		if (fd != -1) {
+
+			// further writes may block, but only the writer itself
+			flags = fcntl(fd, F_GETFL);
+			fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+
+			return fd;
+		}
+		else if (errno != ENXIO) {
+			std::cout << "Telemetry> Cannot open sink " << this->sink << ": " << std::strerror(errno) << std::endl;
+
+			return -1;
+		}
+
+		// retry later, unless shut down in the meantime
+		this->records_available.wait_for(lock, std::chrono::milliseconds(Telemetry::OPEN_RETRY_INTERVAL_MS), [&]() {
+				return this->shutdown;
+			});
+	}
+
+	return -1;
+}
+
+void Telemetry::write() {
+	std::vector<Record> pending;
+	std::stringstream lines;
+	std::string buffer;
+	sigset_t sigpipe;
+	size_t written;
+	ssize_t ret;
+	int fd;
+	bool done;
+
+	// a reader closing the FIFO shall not terminate the whole run; w/ SIGPIPE
+	// blocked for the writer, the write fails w/ EPIPE instead
+	sigemptyset(&sigpipe);
+	sigaddset(&sigpipe, SIGPIPE);
+	pthread_sigmask(SIG_BLOCK, &sigpipe, nullptr);
+
+	pending.reserve(Telemetry::MAX_PENDING_RECORDS);
+	lines.precision(10);
+
+	fd = this->open();
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+
+	while (true) {
+
+		// wait for records or shutdown
+		this->records_available.wait(lock, [&]() {
+				return this->shutdown || !this->records.empty();
+			});
+
+		// take over pending records; write them unlocked
+		pending.swap(this->records);
+		done = this->shutdown;
+
+		lock.unlock();
+
+		if (fd != -1) {
+
+			lines.str("");
+
+			// one JSON object per line
+			for (Record const& record : pending) {
+				lines << "{";
+				lines << "\"step\": " << record.step << ", ";
+				lines << "\"temp\": " << record.temp << ", ";
+				lines << "\"SA_phase\": " << record.SA_phase << ", ";
+				lines << "\"cooling_phase\": " << record.cooling_phase << ", ";
+				lines << "\"avg_cost\": " << record.avg_cost << ", ";
+				lines << "\"best_cost\": " << record.best_cost << ", ";
+				lines << "\"new_best_sol_found\": " << (record.new_best_sol_found ? "true" : "false") << ", ";
+				lines << "\"accepted_ops_ratio\": " << record.accepted_ops_ratio << ", ";
+				lines << "\"fitting_layouts_ratio\": " << record.fitting_layouts_ratio << ", ";
+				lines << "\"ops_per_sec\": " << record.ops_per_sec << ", ";
+				lines << "\"cost_terms\": {";
+				lines << "\"area_outline\": " << record.cost_area_outline << ", ";
+				lines << "\"HPWL\": " << record.cost_HPWL << ", ";
+				lines << "\"routing_util\": " << record.cost_routing_util << ", ";
+				lines << "\"TSVs\": " << record.cost_TSVs << ", ";
+				lines << "\"alignments\": " << record.cost_alignments << ", ";
+				lines << "\"thermal\": " << record.cost_thermal;
+				lines << "}, ";
+				lines << "\"rss_mb\": " << Telemetry::residentSetSize();
+				lines << "}" << std::endl;
+			}
+
+			buffer = lines.str();
+
+			// write all lines at once; handle partial writes
+			written = 0;
+			while (written < buffer.size()) {
+
+				ret = ::write(fd, buffer.data() + written, buffer.size() - written);
+
+				if (ret == -1) {
+
+					if (errno == EINTR) {
+						continue;
+					}
+
+					// sink is gone, e.g., the reader closed the FIFO;
+					// drop further records
+					std::cout << "Telemetry> Cannot write to sink " << this->sink << ": " << std::strerror(errno) << std::endl;
+
+					::close(fd);
+					fd = -1;
+
+					break;
+				}
+
+				written += ret;
+			}
+		}
+
+		pending.clear();
+
+		lock.lock();
+
+		// records queued after shutdown are not expected, but write them
+		// anyway before leaving
+		if (done && this->records.empty()) {
+			break;
+		}
+	}
+
+	lock.unlock();
+
+	if (fd != -1) {
+		::close(fd);
+	}
+
+	if (Telemetry::DBG) {
+		std::cout << "DBG_TELEMETRY> Writer shut down" << std::endl;
+	}
+}
+
+double Telemetry::residentSetSize() {
+	std::ifstream statm;
+	unsigned long size, resident;
+
+	statm.open("/proc/self/statm");
+
+	if (!(statm >> size >> resident)) {
+		return 0.0;
+	}
+
+	return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
@@ -0,0 +1,106 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar streaming of SA telemetry as JSON lines
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_TELEMETRY
+#define _CORBLIVAR_TELEMETRY
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+class Telemetry {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// public data, functions
+	public:
+		// POD; telemetry of one SA temperature step
+		struct Record {
+			int step;
+			double temp;
+			unsigned SA_phase;
+			unsigned cooling_phase;
+			double avg_cost;
+			double best_cost;
+			bool new_best_sol_found;
+			double accepted_ops_ratio;
+			double fitting_layouts_ratio;
+			double ops_per_sec;
+			// weighted cost terms of the most recently accepted layout
+			double cost_area_outline;
+			double cost_HPWL;
+			double cost_routing_util;
+			double cost_TSVs;
+			double cost_alignments;
+			double cost_thermal;
+		};
+
+	// private data, functions
+	private:
+		// file or FIFO to append the JSON lines to
+		std::string sink;
+
+		// persistent writer thread; the records are formatted and written
+		// there, thus the SA is never blocked on I/O
+		std::thread writer;
+
+		// synchronization
+		std::mutex mutex;
+		std::condition_variable records_available;
+
+		// pending records; bounded, in case the sink (e.g., a FIFO w/o reader)
+		// doesn't keep up, further records are dropped
+		std::vector<Record> records;
+		static constexpr unsigned MAX_PENDING_RECORDS = 1024;
+		unsigned long dropped;
+		bool shutdown;
+
+		// writer routine
+		void write();
+
+		// helper for writer; open sink w/o blocking on FIFOs w/o reader;
+		// returns file descriptor, or -1 if the writer is shut down before
+		static constexpr unsigned OPEN_RETRY_INTERVAL_MS = 100;
+		int open();
+
+		// helper for writer; resident set size in MB, as of /proc/self/statm
+		static double residentSetSize();
+
+	// constructors, destructors, if any non-implicit
+	public:
+		Telemetry(std::string const& sink);
+		// remaining records are written before the writer is shut down
+		~Telemetry();
+
+	// public data, functions
+	public:
+		// queue record for writing; never blocks on I/O
+		void record(Record const& record);
+
+		inline std::string const& getSink() const {
+			return this->sink;
+		};
+};
+
+#endif
@@ -23,15 +23,20 @@
 
 // own Corblivar header
 #include "ThermalAnalyzer.hpp"
+// vector intrinsics for power-blurring kernels; only for x86 architectures
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 // required Corblivar headers
 #include "Rect.hpp"
 #include "Net.hpp"
 #include "Block.hpp"
 #include "Math.hpp"
 #include "CorblivarAlignmentReq.hpp"
+#include "PhaseTimers.hpp"
 
 // memory allocation
-constexpr int ThermalAnalyzer::POWER_MAPS_DIM;
+constexpr int ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
 
 void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 	int x, y;
@@ -40,13 +45,22 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 		std::cout << "-> ThermalAnalyzer::initThermalMap()" << std::endl;
 	}
 
+	// allocate thermal map and buffers for power blurring
+	this->thermal_map.assign(this->thermal_map_dim, std::vector<ThermalMapBin>(this->thermal_map_dim));
+	this->thermal_map_tmp.assign(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
+	this->thermal_map_final.assign(this->thermal_map_dim, std::vector<double>(this->thermal_map_dim, 0.0));
+	// buffers for incremental updates
+	this->incremental.delta_power.assign(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
+	this->incremental.delta_tmp.assign(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
+	this->incremental.valid = false;
+
 	// scale of thermal map dimensions
-	this->thermal_map_dim_x = die_outline.x / ThermalAnalyzer::THERMAL_MAP_DIM;
-	this->thermal_map_dim_y = die_outline.y / ThermalAnalyzer::THERMAL_MAP_DIM;
+	this->thermal_map_dim_x = die_outline.x / this->thermal_map_dim;
+	this->thermal_map_dim_y = die_outline.y / this->thermal_map_dim;
 
 	// init map data structure
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < this->thermal_map_dim; x++) {
+		for (y = 0; y < this->thermal_map_dim; y++) {
 
 			this->thermal_map[x][y] = {
 					// init w/ zero temp value
@@ -76,8 +90,8 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 
 	// build-up neighbor relations for thermal-map grid;
 	// inner core
-	for (x = 1; x < ThermalAnalyzer::THERMAL_MAP_DIM - 1; x++) {
-		for (y = 1; y < ThermalAnalyzer::THERMAL_MAP_DIM - 1; y++) {
+	for (x = 1; x < this->thermal_map_dim - 1; x++) {
+		for (y = 1; y < this->thermal_map_dim - 1; y++) {
 
 			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y-1]);
 			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
@@ -93,7 +107,7 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 	// build-up neighbor relations for thermal-map grid;
 	// outer rows and columns 
 	x = 0;
-	for (y = 1; y < ThermalAnalyzer::THERMAL_MAP_DIM - 1; y++) {
+	for (y = 1; y < this->thermal_map_dim - 1; y++) {
 
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y+1]);
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y+1]);
@@ -102,8 +116,8 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y-1]);
 	}
 
-	x = ThermalAnalyzer::THERMAL_MAP_DIM - 1;
-	for (y = 1; y < ThermalAnalyzer::THERMAL_MAP_DIM - 1; y++) {
+	x = this->thermal_map_dim - 1;
+	for (y = 1; y < this->thermal_map_dim - 1; y++) {
 
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y-1]);
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
@@ -113,7 +127,7 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 	}
 
 	y = 0;
-	for (x = 1; x < ThermalAnalyzer::THERMAL_MAP_DIM - 1; x++) {
+	for (x = 1; x < this->thermal_map_dim - 1; x++) {
 
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y+1]);
@@ -122,8 +136,8 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y]);
 	}
 
-	y = ThermalAnalyzer::THERMAL_MAP_DIM - 1;
-	for (x = 1; x < ThermalAnalyzer::THERMAL_MAP_DIM - 1; x++) {
+	y = this->thermal_map_dim - 1;
+	for (x = 1; x < this->thermal_map_dim - 1; x++) {
 
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y-1]);
 		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
@@ -137,18 +151,18 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 	this->thermal_map[0][0].neighbors.push_back(&this->thermal_map[0][1]);
 	this->thermal_map[0][0].neighbors.push_back(&this->thermal_map[1][1]);
 	this->thermal_map[0][0].neighbors.push_back(&this->thermal_map[1][0]);
-	this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(&this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(&this->thermal_map[1][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(&this->thermal_map[1][ThermalAnalyzer::THERMAL_MAP_DIM - 1]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(
-			&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][ThermalAnalyzer::THERMAL_MAP_DIM - 1]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(
-			&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(
-			&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][0].neighbors.push_back(&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][0]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][0].neighbors.push_back(&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][1]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][0].neighbors.push_back(&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][1]);
+	this->thermal_map[0][this->thermal_map_dim - 1].neighbors.push_back(&this->thermal_map[0][this->thermal_map_dim - 2]);
+	this->thermal_map[0][this->thermal_map_dim - 1].neighbors.push_back(&this->thermal_map[1][this->thermal_map_dim - 2]);
+	this->thermal_map[0][this->thermal_map_dim - 1].neighbors.push_back(&this->thermal_map[1][this->thermal_map_dim - 1]);
+	this->thermal_map[this->thermal_map_dim - 1][this->thermal_map_dim - 1].neighbors.push_back(
+			&this->thermal_map[this->thermal_map_dim - 2][this->thermal_map_dim - 1]);
+	this->thermal_map[this->thermal_map_dim - 1][this->thermal_map_dim - 1].neighbors.push_back(
+			&this->thermal_map[this->thermal_map_dim - 2][this->thermal_map_dim - 2]);
+	this->thermal_map[this->thermal_map_dim - 1][this->thermal_map_dim - 1].neighbors.push_back(
+			&this->thermal_map[this->thermal_map_dim - 1][this->thermal_map_dim - 2]);
+	this->thermal_map[this->thermal_map_dim - 1][0].neighbors.push_back(&this->thermal_map[this->thermal_map_dim - 2][0]);
+	this->thermal_map[this->thermal_map_dim - 1][0].neighbors.push_back(&this->thermal_map[this->thermal_map_dim - 2][1]);
+	this->thermal_map[this->thermal_map_dim - 1][0].neighbors.push_back(&this->thermal_map[this->thermal_map_dim - 1][1]);
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "<- ThermalAnalyzer::initThermalMap" << std::endl;
@@ -156,9 +170,8 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 }
 
 void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline) {
-	unsigned b;
+	int b;
 	int i;
-	ThermalAnalyzer::PowerMapBin init_bin;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "-> ThermalAnalyzer::initPowerMaps(" << layers << ", " << die_outline.x << ", " << die_outline.y << ")" << std::endl;
@@ -166,25 +179,23 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 
 	this->power_maps.clear();
 
-	// allocate power-maps arrays
+	// allocate power-maps arrays; init the maps w/ zero values
 	for (i = 0; i < layers; i++) {
 		this->power_maps.emplace_back(
-			std::array<std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM>()
+			ThermalAnalyzer::PowerMap()
 		);
-	}
 
-	// init the maps w/ zero values
-	init_bin.power_density = init_bin.TSV_density = 0.0;
-	for (i = 0; i < layers; i++) {
-		for (auto& partial_map : this->power_maps[i]) {
-			partial_map.fill(init_bin);
-		}
+		this->power_maps.back().power_density.assign(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
+		this->power_maps.back().TSV_density.assign(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
 	}
 
 	// scale power map dimensions to outline of thermal map; this way the padding of
 	// power maps doesn't distort the block outlines in the thermal map
-	this->power_maps_dim_x = die_outline.x / ThermalAnalyzer::THERMAL_MAP_DIM;
-	this->power_maps_dim_y = die_outline.y / ThermalAnalyzer::THERMAL_MAP_DIM;
+	this->power_maps_dim_x = die_outline.x / this->thermal_map_dim;
+	this->power_maps_dim_y = die_outline.y / this->thermal_map_dim;
+
+	// maps are reset, enforce full analysis
+	this->incremental.valid = false;
 
 	// determine offset for blocks, related to padding of power maps
 	this->blocks_offset_x = this->power_maps_dim_x * ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
@@ -198,10 +209,12 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 	// predetermine map bins' area and lower-left corner coordinates; note that the
 	// last bin represents the upper-right coordinates for the penultimate bin
 	this->power_maps_bin_area = this->power_maps_dim_x * this->power_maps_dim_y;
-	for (b = 0; b <= ThermalAnalyzer::POWER_MAPS_DIM; b++) {
+	this->power_maps_bins_ll_x.resize(this->power_maps_dim + 1);
+	this->power_maps_bins_ll_y.resize(this->power_maps_dim + 1);
+	for (b = 0; b <= this->power_maps_dim; b++) {
 		this->power_maps_bins_ll_x[b] = b * this->power_maps_dim_x;
 	}
-	for (b = 0; b <= ThermalAnalyzer::POWER_MAPS_DIM; b++) {
+	for (b = 0; b <= this->power_maps_dim; b++) {
 		this->power_maps_bins_ll_y[b] = b * this->power_maps_dim_y;
 	}
 
@@ -221,6 +234,8 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	double scale;
 	double layer_impulse_factor;
 	int x_y;
+	std::string ISA;
+	bool specialized;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "-> ThermalAnalyzer::initThermalMasks(" << layers << ", " << log << ")" << std::endl;
@@ -290,7 +305,49 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 		std::cout << "DBG> Note that these values will be multiplied w/ each other in the final 2D mask" << std::endl;
 	}
 
+	// sum up masks of all layers; the vertical convolution of the (summed up)
+	// horizontal convolutions is linear, thus the summed-up masks can be applied
+	// at once for incremental updates of the thermal map
+	this->thermal_masks_sum.fill(0.0);
+	for (i = 0; i < layers; i++) {
+		for (x_y = 0; x_y < ThermalAnalyzer::THERMAL_MASK_DIM; x_y++) {
+			this->thermal_masks_sum[x_y] += this->thermal_masks[i][x_y];
+		}
+	}
+
+	// select kernels for power blurring, according to CPU features and map
+	// dimensions
+	ISA = "scalar";
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f")) {
+		ISA = "AVX-512";
+	}
+	else if (__builtin_cpu_supports("avx2")) {
+		ISA = "AVX2";
+	}
+#endif
+	this->convolution_kernel_horizontal = ThermalAnalyzer::convolutionKernel(ISA, this->power_maps_dim, specialized);
+	this->convolution_kernel_vertical = ThermalAnalyzer::convolutionKernel(ISA, this->thermal_map_dim, specialized);
+	// kernel for windows of arbitrary size, required for incremental updates
+	this->convolution_kernel_generic = ThermalAnalyzer::convolutionKernel<0>(ISA);
+
+	// masks may have changed, enforce full analysis
+	this->incremental.valid = false;
+
 	if (log) {
+		std::cout << "ThermalAnalyzer> ";
+		std::cout << "Thermal-map dimension: " << this->thermal_map_dim << " x " << this->thermal_map_dim << std::endl;
+		std::cout << "ThermalAnalyzer> ";
+		std::cout << "Power-blurring kernel: " << ISA;
+		if (specialized) {
+			std::cout << ", specialized for map dimension" << std::endl;
+		}
+		else {
+			std::cout << ", generic" << std::endl;
+		}
+
 		std::cout << "ThermalAnalyzer> ";
 		std::cout << "Done" << std::endl << std::endl;
 	}
@@ -300,269 +357,870 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	}
 }
 
-void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
+void ThermalAnalyzer::generatePowerMaps(int const& layers, BlocksGeometry const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
 	int i;
-	int x, y;
-	Rect bin, intersect, block_offset;
-	int x_lower, x_upper, y_lower, y_upper;
-	bool padding_zone;
-	ThermalAnalyzer::PowerMapBin init_bin;
+	unsigned b;
+	Rect block_offset;
+	MapWindow block_window;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::GENERATE_POWER_MAPS);
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "-> ThermalAnalyzer::generatePowerMaps(" << layers << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), " << &parameters << ", " << extend_boundary_blocks_into_padding_zone << ")" << std::endl;
 	}
 
-	init_bin.power_density = 0.0;
-	init_bin.TSV_density = 0.0;
+	this->initRaster(layers);
+
+	// rasterize all blocks, each into the difference array of its layer; this way,
+	// the blocks are bucketed by layer w/ one pass
+	for (b = 0; b < blocks.size(); b++) {
+
+		block_window = this->determBlockWindow(blocks.bb(b), blocks.layer[b], die_outline, extend_boundary_blocks_into_padding_zone, block_offset);
+
+		this->rasterize(blocks.layer[b], block_offset, block_window, blocks.power_density[b]);
+	}
 
 	// determine maps for each layer
 	for (i = 0; i < layers; i++) {
 
 		// reset map to zero
 		// note: this also implicitly pads the map w/ zero power density
-		for (auto& m : this->power_maps[i]) {
-			m.fill(init_bin);
+		for (auto& m : this->power_maps[i].power_density) {
+			std::fill(m.begin(), m.end(), 0.0);
+		}
+		for (auto& m : this->power_maps[i].TSV_density) {
+			std::fill(m.begin(), m.end(), 0.0);
 		}
 
-		// consider each block on the related layer
-		for (Block const& block : blocks) {
+		// derive map from difference array; consider scaling of padding zone
+		this->addRaster(this->power_maps[i].power_density, i, parameters.power_density_scaling_padding_zone);
+	}
 
-			// drop blocks assigned to other layers
-			if (block.layer != i) {
-				continue;
+	// compare against maps derived via intersections; the reference maps are
+	// w/o any rounding residue for empty bins
+	if (ThermalAnalyzer::DBG_RASTER) {
+		MapWindow window = {0, 0, this->power_maps_dim, 0, this->power_maps_dim};
+
+		for (i = 0; i < layers; i++) {
+			std::vector< std::vector<double> > reference(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
+
+			for (b = 0; b < blocks.size(); b++) {
+
+				if (blocks.layer[b] != i) {
+					continue;
+				}
+
+				block_window = this->determBlockWindow(blocks.bb(b), i, die_outline, extend_boundary_blocks_into_padding_zone, block_offset);
+				this->mapBlock(reference, blocks.power_density[b], block_offset, block_window, window, parameters);
 			}
 
-			// determine offset, i.e., shifted, block bb; relates to block's
-			// bb in padded power map
-			block_offset = block.bb;
+			this->checkRaster(this->power_maps[i].power_density, reference, i, "Power");
+		}
+	}
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "<- ThermalAnalyzer::generatePowerMaps" << std::endl;
+	}
+}
+
+void ThermalAnalyzer::initRaster(int const& layers) {
+
+	this->raster.resize(layers);
 
-			// don't offset blocks at the left/lower chip boundaries,
-			// implicitly extend them into power-map padding zone; this way,
-			// during convolution, the thermal estimate increases for these
-			// blocks; blocks not at the boundaries are shifted
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
+	for (auto& r : this->raster) {
+		r.assign((this->power_maps_dim + 1) * (this->power_maps_dim + 1), 0.0);
+	}
+}
+
+// determine the segments of bins [lower, upper) w/ same coverage by the bb, i.e., the
+// boundary bins and the fully covered bins in between; returns the count of segments
+int ThermalAnalyzer::determRasterSegments(std::array<RasterSegment, 3>& segments, int const& lower, int const& upper, double const& bb_lower, double const& bb_upper,
+		std::vector<double> const& bins_ll, double const& bin_dim) const {
+	int count = 0;
+
+	// lambda expression; coverage of bin, normalized to bin dimension; same as for
+	// intersection in mapBlock
+	auto coverage = [&](int const& bin) {
+		return std::max(0.0, std::min(bins_ll[bin + 1], bb_upper) - std::max(bins_ll[bin], bb_lower)) / bin_dim;
+	};
+
+	if (upper <= lower) {
+		return 0;
+	}
+
+	// lower boundary bin
+	segments[count++] = {lower, lower + 1, coverage(lower)};
+
+	// fully covered bins
+	if (upper - lower > 2) {
+		segments[count++] = {lower + 1, upper - 1, 1.0};
+	}
+
+	// upper boundary bin
+	if (upper - lower > 1) {
+		segments[count++] = {upper - 1, upper, coverage(upper - 1)};
+	}
+
+	return count;
+}
+
+void ThermalAnalyzer::rasterize(int const& layer, Rect const& offset, MapWindow const& bb_window, double const& value) {
+	int x, y;
+	int count_x, count_y;
+	int stride;
+	double v;
+	std::array<RasterSegment, 3> segments_x, segments_y;
+	std::vector<double>& diff = this->raster[layer];
+
+	count_x = this->determRasterSegments(segments_x, bb_window.x_lower, bb_window.x_upper, offset.ll.x, offset.ur.x, this->power_maps_bins_ll_x, this->power_maps_dim_x);
+	count_y = this->determRasterSegments(segments_y, bb_window.y_lower, bb_window.y_upper, offset.ll.y, offset.ur.y, this->power_maps_bins_ll_y, this->power_maps_dim_y);
+
+	stride = this->power_maps_dim + 1;
+
+	// add rectangles of constant value to difference array; only the corners of
+	// rectangles are marked
+	for (x = 0; x < count_x; x++) {
+		for (y = 0; y < count_y; y++) {
+
+			v = value * segments_x[x].coverage * segments_y[y].coverage;
+
+			diff[segments_x[x].lower * stride + segments_y[y].lower] += v;
+			diff[segments_x[x].upper * stride + segments_y[y].lower] -= v;
+			diff[segments_x[x].lower * stride + segments_y[y].upper] -= v;
+			diff[segments_x[x].upper * stride + segments_y[y].upper] += v;
+		}
+	}
+}
+
+// derive map values from difference array, via prefix sums along both dimensions; the
+// resulting values are added to the map
+void ThermalAnalyzer::addRaster(std::vector< std::vector<double> >& map, int const& layer, double const& padding_zone_scaling) {
+	int x, y;
+	int stride;
+	bool padding_zone;
+	double value, max_value, residue;
+	std::vector<double>& diff = this->raster[layer];
+
+	stride = this->power_maps_dim + 1;
+
+	// prefix sums along y-dimension
+	for (x = 0; x < this->power_maps_dim; x++) {
+		for (y = 1; y < this->power_maps_dim; y++) {
+			diff[x * stride + y] += diff[x * stride + y - 1];
+		}
+	}
+
+	// prefix sums along x-dimension, i.e., the actual values; also track the
+	// layer's max value
+	max_value = 0.0;
+	for (x = 0; x < this->power_maps_dim; x++) {
+		for (y = 0; y < this->power_maps_dim; y++) {
+
+			if (x > 0) {
+				diff[x * stride + y] += diff[(x - 1) * stride + y];
 			}
-			else {
-				block_offset.ll.x += this->blocks_offset_x;
+
+			max_value = std::max(max_value, std::abs(diff[x * stride + y]));
+		}
+	}
+
+	// the marked corners of all bbs cancel out outside of the bbs only up to
+	// rounding errors; such residue, relative to the layer's max value, is
+	// snapped to zero, and any remaining negative values are clamped, such that
+	// empty bins are exactly zero
+	residue = max_value * ThermalAnalyzer::RASTER_RESIDUE_EPSILON;
+
+	for (x = 0; x < this->power_maps_dim; x++) {
+		for (y = 0; y < this->power_maps_dim; y++) {
+
+			value = diff[x * stride + y];
+
+			if (std::abs(value) < residue) {
+				continue;
 			}
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
+			value = std::max(0.0, value);
+
+			// determine if bin w/in padding zone
+			padding_zone = (
+					x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+					|| x >= (this->power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+					|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+					|| y >= (this->power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+				);
+
+			if (padding_zone) {
+				map[x][y] += value * padding_zone_scaling;
 			}
 			else {
-				block_offset.ll.y += this->blocks_offset_y;
+				map[x][y] += value;
 			}
+		}
+	}
+}
 
-			// also consider extending blocks into right/upper padding zone if
-			// they are close to the related chip boundaries
-			if (
-					extend_boundary_blocks_into_padding_zone &&
-					std::abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
-			   ) {
-				// consider offset twice in order to reach right/uppper
-				// boundary related to layout described by padded power map
-				block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
+// compare map derived from difference array against reference map, derived via
+// intersections in mapBlock / mapTSVIsland; bins not covered by any bb are empty in
+// the reference map, and have to be exactly zero in the derived map as well
+void ThermalAnalyzer::checkRaster(std::vector< std::vector<double> > const& map, std::vector< std::vector<double> > const& reference, int const& layer, std::string const& map_type) const {
+	int x, y;
+	int empty_bins, residue_bins;
+	double max_deviation;
+
+	empty_bins = residue_bins = 0;
+	max_deviation = 0.0;
+
+	for (x = 0; x < this->power_maps_dim; x++) {
+		for (y = 0; y < this->power_maps_dim; y++) {
+
+			if (reference[x][y] == 0.0) {
+				empty_bins++;
+
+				if (map[x][y] != 0.0) {
+					residue_bins++;
+
+					std::cout << "DBG_RASTER> " << map_type << " map, layer " << layer << "; bin " << x << "," << y;
+					std::cout << " is empty but has value " << map[x][y] << std::endl;
+				}
 			}
-			// simple shift otherwise; compensate for padding of left/bottom
-			// boundaries
 			else {
-				block_offset.ur.x += this->blocks_offset_x;
+				max_deviation = std::max(max_deviation, std::abs(map[x][y] - reference[x][y]));
 			}
+		}
+	}
+
+	std::cout << "DBG_RASTER> " << map_type << " map, layer " << layer << "; empty bins: " << empty_bins;
+	std::cout << "; w/ residue: " << residue_bins << "; max deviation of covered bins: " << max_deviation << std::endl;
+}
+
+ThermalAnalyzer::MapWindow ThermalAnalyzer::determBlockWindow(Rect const& bb, int const& layer, Point const& die_outline, bool const& extend_boundary_blocks_into_padding_zone, Rect& block_offset) const {
+	MapWindow ret;
+
+	// determine offset, i.e., shifted, block bb; relates to block's bb in padded
+	// power map
+	block_offset = bb;
+
+	// don't offset blocks at the left/lower chip boundaries, implicitly extend them
+	// into power-map padding zone; this way, during convolution, the thermal
+	// estimate increases for these blocks; blocks not at the boundaries are shifted
+	if (extend_boundary_blocks_into_padding_zone && bb.ll.x == 0.0) {
+	}
+	else {
+		block_offset.ll.x += this->blocks_offset_x;
+	}
+	if (extend_boundary_blocks_into_padding_zone && bb.ll.y == 0.0) {
+	}
+	else {
+		block_offset.ll.y += this->blocks_offset_y;
+	}
+
+	// also consider extending blocks into right/upper padding zone if they are
+	// close to the related chip boundaries
+	if (
+			extend_boundary_blocks_into_padding_zone &&
+			std::abs(die_outline.x - bb.ur.x) < this->padding_right_boundary_blocks_distance
+	   ) {
+		// consider offset twice in order to reach right/uppper boundary related
+		// to layout described by padded power map
+		block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
+	}
+	// simple shift otherwise; compensate for padding of left/bottom boundaries
+	else {
+		block_offset.ur.x += this->blocks_offset_x;
+	}
+
+	if (
+			extend_boundary_blocks_into_padding_zone
+			&& std::abs(die_outline.y - bb.ur.y) < this->padding_upper_boundary_blocks_distance
+	   ) {
+		block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
+	}
+	else {
+		block_offset.ur.y += this->blocks_offset_y;
+	}
+
+	ret.layer = layer;
 
+	// determine index boundaries for offset block; based on boundary of blocks and
+	// the covered bins; note that cast to int truncates toward zero, i.e., performs
+	// like floor for positive numbers
+	ret.x_lower = static_cast<int>(block_offset.ll.x / this->power_maps_dim_x);
+	ret.y_lower = static_cast<int>(block_offset.ll.y / this->power_maps_dim_y);
+	// +1 in order to efficiently emulate the result of ceil(); limit upper bound to
+	// power-maps dimenions
+	ret.x_upper = std::min(static_cast<int>(block_offset.ur.x / this->power_maps_dim_x) + 1, this->power_maps_dim);
+	ret.y_upper = std::min(static_cast<int>(block_offset.ur.y / this->power_maps_dim_y) + 1, this->power_maps_dim);
+
+	return ret;
+}
+
+void ThermalAnalyzer::mapBlock(std::vector< std::vector<double> >& map, double const& power_density, Rect const& block_offset, MapWindow const& block_window, MapWindow const& window, MaskParameters const& parameters) const {
+	int x, y;
+	Rect bin, intersect;
+	bool padding_zone;
+
+	// walk power-map bins covering block outline, limited to window
+	for (x = std::max(block_window.x_lower, window.x_lower); x < std::min(block_window.x_upper, window.x_upper); x++) {
+		for (y = std::max(block_window.y_lower, window.y_lower); y < std::min(block_window.y_upper, window.y_upper); y++) {
+
+			// determine if bin w/in padding zone
 			if (
-					extend_boundary_blocks_into_padding_zone
-					&& std::abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
+					x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+					|| x >= (this->power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+					|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+					|| y >= (this->power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
 			   ) {
-				block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
+				padding_zone = true;
 			}
 			else {
-				block_offset.ur.y += this->blocks_offset_y;
+				padding_zone = false;
 			}
 
-			// determine index boundaries for offset block; based on boundary
-			// of blocks and the covered bins; note that cast to int truncates
-			// toward zero, i.e., performs like floor for positive numbers
-			x_lower = static_cast<int>(block_offset.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<int>(block_offset.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimenions
-			x_upper = std::min(static_cast<int>(block_offset.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = std::min(static_cast<int>(block_offset.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering block outline
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// determine if bin w/in padding zone
-					if (
-							x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-							|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-					   ) {
-						padding_zone = true;
-					}
-					else {
-						padding_zone = false;
-					}
-
-					// consider full block power density for fully covered bins
-					if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density;
-						}
-					}
-					// else consider block power according to
-					// intersection of current bin and block
-					else {
-						// determine real coords of map bin
-						bin.ll.x = this->power_maps_bins_ll_x[x];
-						bin.ll.y = this->power_maps_bins_ll_y[y];
-						// note that +1 is guaranteed to be within bounds
-						// of power_maps_bins_ll_x/y (size =
-						// ThermalAnalyzer::POWER_MAPS_DIM + 1); the
-						// related last tuple describes the upper-right
-						// corner coordinates of the right/top boundary
-						bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-						bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-						// determine intersection
-						intersect = Rect::determineIntersection(bin, block_offset);
-						// normalize to full bin area
-						intersect.area /= this->power_maps_bin_area;
-
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density * intersect.area * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density * intersect.area;
-						}
-					}
+			// consider full block power density for fully covered bins
+			if (block_window.x_lower < x && x < (block_window.x_upper - 1) && block_window.y_lower < y && y < (block_window.y_upper - 1)) {
+				if (padding_zone) {
+					map[x][y] += power_density * parameters.power_density_scaling_padding_zone;
+				}
+				else {
+					map[x][y] += power_density;
+				}
+			}
+			// else consider block power according to intersection of current bin
+			// and block
+			else {
+				// determine real coords of map bin
+				bin.ll.x = this->power_maps_bins_ll_x[x];
+				bin.ll.y = this->power_maps_bins_ll_y[y];
+				// note that +1 is guaranteed to be within bounds of
+				// power_maps_bins_ll_x/y (size = power_maps_dim + 1); the
+				// related last tuple describes the upper-right corner
+				// coordinates of the right/top boundary
+				bin.ur.x = this->power_maps_bins_ll_x[x + 1];
+				bin.ur.y = this->power_maps_bins_ll_y[y + 1];
+
+				// determine intersection
+				intersect = Rect::determineIntersection(bin, block_offset);
+				// normalize to full bin area
+				intersect.area /= this->power_maps_bin_area;
+
+				if (padding_zone) {
+					map[x][y] += power_density * intersect.area * parameters.power_density_scaling_padding_zone;
+				}
+				else {
+					map[x][y] += power_density * intersect.area;
 				}
 			}
 		}
 	}
-
-	if (ThermalAnalyzer::DBG_CALLS) {
-		std::cout << "<- ThermalAnalyzer::generatePowerMaps" << std::endl;
-	}
 }
 
 void ThermalAnalyzer::adaptPowerMaps(int const& layers, std::vector<TSV_Island> const& TSVs, std::vector<Net> const& nets, MaskParameters const& parameters) {
 	int x, y;
-	Rect aligned_blocks_intersect;
-	Rect bin, bin_intersect;
-	int x_lower, x_upper, y_lower, y_upper;
 	int i;
-	Rect bb, prev_bb;
+	Rect TSV_group_offset;
+	MapWindow TSV_group_window;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "-> ThermalAnalyzer::adaptPowerMaps(" << layers << ", " << &TSVs << ", " << &nets << ", " << &parameters << ")" << std::endl;
 	}
 
-	// consider impact of vertical buses; map TSVs to power maps
-	//
-	// note that local copies of TSVs groups are used in order to not mess with the
-	// actual coordinates of the groups
-	for (TSV_Island TSV_group : TSVs) {
-
-		// offset intersection, i.e., account for padded power maps and related
-		// offset in coordinates
-		TSV_group.bb.ll.x += this->blocks_offset_x;
-		TSV_group.bb.ll.y += this->blocks_offset_y;
-		TSV_group.bb.ur.x += this->blocks_offset_x;
-		TSV_group.bb.ur.y += this->blocks_offset_y;
-
-		// determine index boundaries for offset intersection; based on boundary
-		// of intersection and the covered bins; note that cast to int truncates
-		// toward zero, i.e., performs like floor for positive numbers
-		x_lower = static_cast<int>(TSV_group.bb.ll.x / this->power_maps_dim_x);
-		y_lower = static_cast<int>(TSV_group.bb.ll.y / this->power_maps_dim_y);
-		// +1 in order to efficiently emulate the result of ceil(); limit upper
-		// bound to power-maps dimensions
-		x_upper = std::min(static_cast<int>(TSV_group.bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-		y_upper = std::min(static_cast<int>(TSV_group.bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+	this->initRaster(layers);
+
+	// consider impact of vertical buses; rasterize TSVs for TSV-density maps
+	for (TSV_Island const& TSV_group : TSVs) {
+
+		TSV_group_window = this->determTSVIslandWindow(TSV_group.bb, TSV_group.layer, TSV_group_offset);
 
 		if (ThermalAnalyzer::DBG) {
-			std::cout << "DBG> TSV group " << TSV_group.id << std::endl;
-			std::cout << "DBG>  Affected power-map bins: " << x_lower << "," << y_lower
+			if (TSV_group.alignment_req != -1) {
+				std::cout << "DBG> TSV group of vertical bus, alignment request " << TSV_group.alignment_req << std::endl;
+			}
+			else {
+				std::cout << "DBG> TSV group " << TSV_group.id << std::endl;
+			}
+			std::cout << "DBG>  Affected power-map bins: " << TSV_group_window.x_lower << "," << TSV_group_window.y_lower
 				<< " to " <<
-				x_upper << "," << y_upper << std::endl;
+				TSV_group_window.x_upper << "," << TSV_group_window.y_upper << std::endl;
 		}
 
-		// walk power-map bins covering intersection outline; adapt TSV densities
-		for (x = x_lower; x < x_upper; x++) {
-			for (y = y_lower; y < y_upper; y++) {
+		this->rasterize(TSV_group.layer, TSV_group_offset, TSV_group_window, 100.0);
+	}
 
-				// consider full TSV density for fully covered bins
-				if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
+	// derive TSV-density maps; TSV islands are not extended into the padding
+	// zone, thus no scaling is required
+	for (i = 0; i < layers; i++) {
+		this->addRaster(this->power_maps[i].TSV_density, i, 1.0);
+	}
 
-					// adapt map on affected layer
-					this->power_maps[TSV_group.layer][x][y].TSV_density += 100.0;
-				}
-				// else consider TSV density according to partial
-				// intersection with current bin
-				else {
-					// determine real coords of map bin
-					bin.ll.x = this->power_maps_bins_ll_x[x];
-					bin.ll.y = this->power_maps_bins_ll_y[y];
-					// note that +1 is guaranteed to be within
-					// bounds of power_maps_bins_ll_x/y (size
-					// = ThermalAnalyzer::POWER_MAPS_DIM + 1);
-					// the related last tuple describes the
-					// upper-right corner coordinates of the
-					// right/top boundary
-					bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-					bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-					// determine intersection
-					bin_intersect = Rect::determineIntersection(bin, TSV_group.bb);
-					// normalize to full bin area
-					bin_intersect.area /= this->power_maps_bin_area;
-
-					// adapt map on affected layer
-					this->power_maps[TSV_group.layer][x][y].TSV_density += 100.0 * bin_intersect.area;
+	// compare against maps derived via intersections, see generatePowerMaps
+	if (ThermalAnalyzer::DBG_RASTER) {
+		MapWindow window = {0, 0, this->power_maps_dim, 0, this->power_maps_dim};
+
+		for (i = 0; i < layers; i++) {
+			std::vector< std::vector<double> > reference(this->power_maps_dim, std::vector<double>(this->power_maps_dim, 0.0));
+
+			for (TSV_Island const& TSV_group : TSVs) {
+
+				if (TSV_group.layer != i) {
+					continue;
 				}
+
+				TSV_group_window = this->determTSVIslandWindow(TSV_group.bb, i, TSV_group_offset);
+				this->mapTSVIsland(reference, TSV_group_offset, TSV_group_window, window);
 			}
+
+			this->checkRaster(this->power_maps[i].TSV_density, reference, i, "TSV-density");
 		}
 	}
 
 	// walk power-map bins; adapt power according to TSV densities
-	for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-		for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+	for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+		for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
 
 			// sanity check; TSV density should be <= 100%; might be larger
 			// due to superposition in calculations above
 			for (i = 0; i < layers; i++) {
-				this->power_maps[i][x][y].TSV_density = std::min(100.0, this->power_maps[i][x][y].TSV_density);
+				this->power_maps[i].TSV_density[x][y] = std::min(100.0, this->power_maps[i].TSV_density[x][y]);
 			}
 
 			// adapt maps for all layers; the uppermost layer next the
 			// heatsink may also contain (dummy) thermal TSVs
 			for (i = 0; i < layers; i++) {
+				this->power_maps[i].power_density[x][y] = ThermalAnalyzer::adaptPowerDensity(this->power_maps[i].power_density[x][y], this->power_maps[i].TSV_density[x][y], parameters);
+			}
+		}
+	}
 
-				// ignore cases w/o TSVs
-				if (this->power_maps[i][x][y].TSV_density == 0.0)
-					continue;
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "<- ThermalAnalyzer::adaptPowerMaps" << std::endl;
+	}
+}
 
-				// scaling depends on TSV density; the larger the TSV
-				// density, the larger the power down-scaling; note that
-				// the factor power_density_scaling_TSV_region ranges b/w
-				// 0.0 and 1.0, whereas TSV_density ranges b/w 0.0 and
-				// 100.0
-				this->power_maps[i][x][y].power_density *=
-					1.0 +
-					((parameters.power_density_scaling_TSV_region - 1.0) / 100.0) * this->power_maps[i][x][y].TSV_density;
+void ThermalAnalyzer::scalePowerMaps(int const& layers, std::vector<PowerMap> const& unscaled_power_maps, MaskParameters const& parameters) {
+	int x, y;
+	int i;
+	bool padding_zone;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "-> ThermalAnalyzer::scalePowerMaps(" << layers << ", " << &unscaled_power_maps << ", " << &parameters << ")" << std::endl;
+	}
+
+	for (i = 0; i < layers; i++) {
+
+		for (x = 0; x < this->power_maps_dim; x++) {
+			for (y = 0; y < this->power_maps_dim; y++) {
+
+				// determine if bin w/in padding zone
+				padding_zone = (
+						x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+						|| x >= (this->power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+						|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+						|| y >= (this->power_maps_dim - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+					);
+
+				this->power_maps[i].TSV_density[x][y] = unscaled_power_maps[i].TSV_density[x][y];
+
+				// scaling of padding zone, see mapBlock
+				if (padding_zone) {
+					this->power_maps[i].power_density[x][y] = unscaled_power_maps[i].power_density[x][y] * parameters.power_density_scaling_padding_zone;
+				}
+				// scaling according to TSV density, see adaptPowerMaps
+				else {
+					this->power_maps[i].power_density[x][y] = ThermalAnalyzer::adaptPowerDensity(unscaled_power_maps[i].power_density[x][y], unscaled_power_maps[i].TSV_density[x][y], parameters);
+				}
 			}
 		}
 	}
 
 	if (ThermalAnalyzer::DBG_CALLS) {
-		std::cout << "<- ThermalAnalyzer::adaptPowerMaps" << std::endl;
+		std::cout << "<- ThermalAnalyzer::scalePowerMaps" << std::endl;
+	}
+}
+
+ThermalAnalyzer::MapWindow ThermalAnalyzer::determTSVIslandWindow(Rect const& bb, int const& layer, Rect& TSV_group_offset) const {
+	MapWindow ret;
+
+	// offset bb, i.e., account for padded power maps and related offset in
+	// coordinates
+	TSV_group_offset = bb;
+	TSV_group_offset.ll.x += this->blocks_offset_x;
+	TSV_group_offset.ll.y += this->blocks_offset_y;
+	TSV_group_offset.ur.x += this->blocks_offset_x;
+	TSV_group_offset.ur.y += this->blocks_offset_y;
+
+	ret.layer = layer;
+
+	// determine index boundaries for offset bb; based on boundary of bb and the
+	// covered bins; note that cast to int truncates toward zero, i.e., performs
+	// like floor for positive numbers
+	ret.x_lower = static_cast<int>(TSV_group_offset.ll.x / this->power_maps_dim_x);
+	ret.y_lower = static_cast<int>(TSV_group_offset.ll.y / this->power_maps_dim_y);
+	// +1 in order to efficiently emulate the result of ceil(); limit upper bound to
+	// power-maps dimensions
+	ret.x_upper = std::min(static_cast<int>(TSV_group_offset.ur.x / this->power_maps_dim_x) + 1, this->power_maps_dim);
+	ret.y_upper = std::min(static_cast<int>(TSV_group_offset.ur.y / this->power_maps_dim_y) + 1, this->power_maps_dim);
+
+	return ret;
+}
+
+void ThermalAnalyzer::mapTSVIsland(std::vector< std::vector<double> >& map, Rect const& TSV_group_offset, MapWindow const& TSV_group_window, MapWindow const& window) const {
+	int x, y;
+	Rect bin, bin_intersect;
+
+	// walk power-map bins covering TSV island, limited to window; adapt TSV
+	// densities
+	for (x = std::max(TSV_group_window.x_lower, window.x_lower); x < std::min(TSV_group_window.x_upper, window.x_upper); x++) {
+		for (y = std::max(TSV_group_window.y_lower, window.y_lower); y < std::min(TSV_group_window.y_upper, window.y_upper); y++) {
+
+			// consider full TSV density for fully covered bins
+			if (TSV_group_window.x_lower < x && x < (TSV_group_window.x_upper - 1) && TSV_group_window.y_lower < y && y < (TSV_group_window.y_upper - 1)) {
+				map[x][y] += 100.0;
+			}
+			// else consider TSV density according to partial intersection
+			// with current bin
+			else {
+				// determine real coords of map bin
+				bin.ll.x = this->power_maps_bins_ll_x[x];
+				bin.ll.y = this->power_maps_bins_ll_y[y];
+				// note that +1 is guaranteed to be within bounds of
+				// power_maps_bins_ll_x/y (size = power_maps_dim + 1); the
+				// related last tuple describes the upper-right corner
+				// coordinates of the right/top boundary
+				bin.ur.x = this->power_maps_bins_ll_x[x + 1];
+				bin.ur.y = this->power_maps_bins_ll_y[y + 1];
+
+				// determine intersection
+				bin_intersect = Rect::determineIntersection(bin, TSV_group_offset);
+				// normalize to full bin area
+				bin_intersect.area /= this->power_maps_bin_area;
+
+				map[x][y] += 100.0 * bin_intersect.area;
+			}
+		}
+	}
+}
+
+void ThermalAnalyzer::performThermalAnalysis(ThermalAnalysisResult& ret, int const& layers, BlocksGeometry const& blocks, std::vector<TSV_Island> const& TSVs, std::vector<Net> const& nets, Point const& die_outline, MaskParameters const& parameters, bool const& incremental) {
+	double max_deviation;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "-> ThermalAnalyzer::performThermalAnalysis(" << &ret << ", " << layers << ", " << &blocks << ", " << &TSVs << ", " << &nets << ", " << &parameters << ", " << incremental << ")" << std::endl;
+	}
+
+	// incremental analysis; update the windows of changed blocks and TSV islands,
+	// considered as long as these windows are sufficiently small and the regular
+	// full analysis is not due
+	if (
+			incremental
+			&& this->incremental.valid
+			&& this->incremental.updates < ThermalAnalyzer::INCREMENTAL_FULL_ANALYSIS_INTERVAL
+			&& this->determChangedWindows(layers, blocks, TSVs, die_outline)
+	   ) {
+
+		for (MapWindow const& window : this->incremental.windows) {
+			this->updateWindow(window, blocks, parameters);
+		}
+
+		this->memorizeIncrementalState(blocks, TSVs);
+		this->incremental.updates++;
+
+		this->determThermalMapResult(ret, parameters);
+
+		// compare w/ full analysis; note that the incremental state is then reset by
+		// the full analysis
+		if (ThermalAnalyzer::DBG_INCREMENTAL) {
+
+			std::vector< std::vector<double> > thermal_map_incremental = this->thermal_map_final;
+
+			this->performThermalAnalysis(ret, layers, blocks, TSVs, nets, die_outline, parameters, false);
+
+			max_deviation = 0.0;
+			for (unsigned x = 0; x < this->thermal_map_final.size(); x++) {
+				for (unsigned y = 0; y < this->thermal_map_final[x].size(); y++) {
+					max_deviation = std::max(max_deviation, std::abs(this->thermal_map_final[x][y] - thermal_map_incremental[x][y]));
+				}
+			}
+
+			std::cout << "DBG_INCREMENTAL> Windows: " << this->incremental.windows.size();
+			std::cout << "; max deviation of incremental thermal map: " << max_deviation << std::endl;
+		}
+	}
+	// full analysis
+	else {
+		// generate power maps based on layout and blocks' power densities
+		this->generatePowerMaps(layers, blocks, die_outline, parameters);
+
+		// adapt power maps to account for TSVs' impact
+		this->adaptPowerMaps(layers, TSVs, nets, parameters);
+
+		// perform actual thermal analysis
+		this->performPowerBlurring(ret, layers, parameters);
+
+		this->memorizeIncrementalState(blocks, TSVs);
+		this->incremental.valid = true;
+		this->incremental.updates = 0;
+	}
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "<- ThermalAnalyzer::performThermalAnalysis" << std::endl;
+	}
+}
+
+// determine windows of power maps to be updated, i.e., windows covered by the previous
+// and current bbs of changed blocks and TSV islands; returns false if an incremental
+// update is not reasonable
+bool ThermalAnalyzer::determChangedWindows(int const& layers, BlocksGeometry const& blocks, std::vector<TSV_Island> const& TSVs, Point const& die_outline) {
+	unsigned b, t;
+	unsigned w1, w2;
+	bool merged;
+	Rect offset, TSV_group_bb;
+	double windows_area;
+
+	// lambda expression; check whether windows are on same layer and overlapping,
+	// including the zone affected by blurring
+	auto overlapping = [&](MapWindow const& w1, MapWindow const& w2) {
+
+		return w1.layer == w2.layer
+			&& w1.x_lower < w2.x_upper + ThermalAnalyzer::THERMAL_MASK_DIM
+			&& w2.x_lower < w1.x_upper + ThermalAnalyzer::THERMAL_MASK_DIM
+			&& w1.y_lower < w2.y_upper + ThermalAnalyzer::THERMAL_MASK_DIM
+			&& w2.y_lower < w1.y_upper + ThermalAnalyzer::THERMAL_MASK_DIM;
+	};
+
+	// lambda expression; memorize window if not empty
+	auto addWindow = [&](MapWindow const& window) {
+
+		if (window.x_lower < window.x_upper && window.y_lower < window.y_upper) {
+			this->incremental.windows.push_back(window);
+		}
+	};
+
+	this->incremental.windows.clear();
+
+	// sanity check for changed set of blocks, e.g., for different benchmark
+	if (this->incremental.blocks.size() != blocks.size()) {
+		return false;
+	}
+
+	// determine windows of current blocks
+	this->incremental.blocks_window.resize(blocks.size());
+	this->incremental.blocks_offset.resize(blocks.size());
+	for (b = 0; b < blocks.size(); b++) {
+		this->incremental.blocks_window[b] = this->determBlockWindow(blocks.bb(b), blocks.layer[b], die_outline, true, this->incremental.blocks_offset[b]);
+	}
+
+	// changed blocks
+	for (b = 0; b < blocks.size(); b++) {
+
+		if (blocks.differs(b, this->incremental.blocks)) {
+
+			addWindow(this->determBlockWindow(this->incremental.blocks.bb(b), this->incremental.blocks.layer[b], die_outline, true, offset));
+			addWindow(this->incremental.blocks_window[b]);
+		}
+	}
+
+	// determine windows of current TSV islands
+	this->incremental.TSVs_window.resize(TSVs.size());
+	this->incremental.TSVs_offset.resize(TSVs.size());
+	for (t = 0; t < TSVs.size(); t++) {
+		this->incremental.TSVs_window[t] = this->determTSVIslandWindow(TSVs[t].bb, TSVs[t].layer, this->incremental.TSVs_offset[t]);
+	}
+
+	// changed TSV islands; islands are re-derived during each layout evaluation, thus
+	// compare the sorted sets of islands; consider islands which were either
+	// removed or added
+	this->memorizeTSVIslands(TSVs, this->incremental.TSVs_cur);
+
+	this->incremental.TSVs_changed.clear();
+	std::set_symmetric_difference(
+			this->incremental.TSVs.begin(), this->incremental.TSVs.end(),
+			this->incremental.TSVs_cur.begin(), this->incremental.TSVs_cur.end(),
+			std::back_inserter(this->incremental.TSVs_changed)
+		);
+
+	for (auto const& TSV_group : this->incremental.TSVs_changed) {
+
+		TSV_group_bb.ll.x = TSV_group.second[0];
+		TSV_group_bb.ll.y = TSV_group.second[1];
+		TSV_group_bb.ur.x = TSV_group.second[2];
+		TSV_group_bb.ur.y = TSV_group.second[3];
+
+		addWindow(this->determTSVIslandWindow(TSV_group_bb, TSV_group.first, offset));
+	}
+
+	// merge overlapping windows into their bounding windows; this way, bins are
+	// not updated multiple times and the zones affected by blurring are shared
+	do {
+		merged = false;
+
+		for (w1 = 0; w1 < this->incremental.windows.size(); w1++) {
+			for (w2 = w1 + 1; w2 < this->incremental.windows.size(); w2++) {
+
+				if (overlapping(this->incremental.windows[w1], this->incremental.windows[w2])) {
+
+					MapWindow& window = this->incremental.windows[w1];
+
+					window.x_lower = std::min(window.x_lower, this->incremental.windows[w2].x_lower);
+					window.x_upper = std::max(window.x_upper, this->incremental.windows[w2].x_upper);
+					window.y_lower = std::min(window.y_lower, this->incremental.windows[w2].y_lower);
+					window.y_upper = std::max(window.y_upper, this->incremental.windows[w2].y_upper);
+
+					// drop merged window
+					this->incremental.windows[w2] = this->incremental.windows.back();
+					this->incremental.windows.pop_back();
+
+					merged = true;
+					w2--;
+				}
+			}
+		}
+	} while (merged);
+
+	// determine area of windows, including the zone affected by blurring
+	windows_area = 0.0;
+	for (MapWindow const& window : this->incremental.windows) {
+		windows_area +=
+			static_cast<double>(window.x_upper - window.x_lower + ThermalAnalyzer::THERMAL_MASK_DIM - 1) *
+			(window.y_upper - window.y_lower + ThermalAnalyzer::THERMAL_MASK_DIM - 1);
+	}
+
+	if (ThermalAnalyzer::DBG) {
+		std::cout << "DBG> Incremental thermal analysis; windows: " << this->incremental.windows.size() << ", covered bins: " << windows_area << std::endl;
+	}
+
+	// incremental update is only reasonable for small windows
+	return windows_area <= ThermalAnalyzer::INCREMENTAL_WINDOWS_AREA_LIMIT * layers * std::pow(this->power_maps_dim, 2);
+}
+
+// update power maps and thermal map for one window; the window's power-map bins are
+// re-determined from scratch, i.e., they match the bins obtained by a full analysis
+// (up to rounding, as full analysis rasterizes the maps);
+// the changes of the power map are then blurred and added to the thermal map; note
+// that windows are handled one by one, thus overlapping windows are covered as well
+void ThermalAnalyzer::updateWindow(MapWindow const& window, BlocksGeometry const& blocks, MaskParameters const& parameters) {
+	unsigned b, t;
+	int x, y;
+	int m;
+	int x_lower, x_upper, y_lower, y_upper;
+	double power_density;
+	std::array<double const*, ThermalAnalyzer::THERMAL_MASK_DIM> rows;
+	PowerMap& power_map = this->power_maps[window.layer];
+
+	// reset window of TSV-density map and (temporary) power map
+	for (x = window.x_lower; x < window.x_upper; x++) {
+		for (y = window.y_lower; y < window.y_upper; y++) {
+			power_map.TSV_density[x][y] = 0.0;
+			this->incremental.delta_power[x][y] = 0.0;
+		}
+	}
+
+	// map all blocks of the window's layer which are intersecting the window
+	for (b = 0; b < blocks.size(); b++) {
+
+		if (blocks.layer[b] != window.layer) {
+			continue;
+		}
+
+		this->mapBlock(this->incremental.delta_power, blocks.power_density[b], this->incremental.blocks_offset[b], this->incremental.blocks_window[b], window, parameters);
+	}
+
+	// map all TSV islands of the window's layer which are intersecting the window
+	for (t = 0; t < this->incremental.TSVs_window.size(); t++) {
+
+		if (this->incremental.TSVs_window[t].layer != window.layer) {
+			continue;
+		}
+
+		this->mapTSVIsland(power_map.TSV_density, this->incremental.TSVs_offset[t], this->incremental.TSVs_window[t], window);
+	}
+
+	// adapt power densities according to TSV densities, only w/in the non-padded
+	// region, just as for full analysis; determine changes of power map, update
+	// power map
+	for (x = window.x_lower; x < window.x_upper; x++) {
+		for (y = window.y_lower; y < window.y_upper; y++) {
+
+			if (
+					ThermalAnalyzer::POWER_MAPS_PADDED_BINS <= x && x < this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+					&& ThermalAnalyzer::POWER_MAPS_PADDED_BINS <= y && y < this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+			   ) {
+				power_map.TSV_density[x][y] = std::min(100.0, power_map.TSV_density[x][y]);
+				this->incremental.delta_power[x][y] = ThermalAnalyzer::adaptPowerDensity(this->incremental.delta_power[x][y], power_map.TSV_density[x][y], parameters);
+			}
+
+			power_density = this->incremental.delta_power[x][y];
+			this->incremental.delta_power[x][y] = power_density - power_map.power_density[x][y];
+			power_map.power_density[x][y] = power_density;
+		}
+	}
+
+	// horizontal convolution of changes; affects the rows w/in the window, extended
+	// by the mask's center, limited to the non-padded region
+	x_lower = std::max(ThermalAnalyzer::POWER_MAPS_PADDED_BINS, window.x_lower - ThermalAnalyzer::THERMAL_MASK_CENTER);
+	x_upper = std::min(this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS, window.x_upper + ThermalAnalyzer::THERMAL_MASK_CENTER);
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			rows[m] = this->incremental.delta_power[x - ThermalAnalyzer::THERMAL_MASK_CENTER + m].data() + window.y_lower;
+		}
+
+		this->convolution_kernel_generic(
+				this->incremental.delta_tmp[x].data() + window.y_lower,
+				rows.data(),
+				this->thermal_masks[window.layer].data(),
+				window.y_upper - window.y_lower
+			);
+	}
+
+	// vertical convolution of changes, w/ the summed-up masks; affects the columns
+	// w/in the window, extended by the mask's dimension
+	y_lower = std::max(0, window.y_lower - (ThermalAnalyzer::THERMAL_MASK_DIM - 1));
+	y_upper = std::min(this->thermal_map_dim, window.y_upper);
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		if (y_lower < y_upper) {
+
+			for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+				rows[m] = this->incremental.delta_tmp[x].data() + y_lower + m;
+			}
+
+			this->convolution_kernel_generic(
+					this->thermal_map_final[x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS].data() + y_lower,
+					rows.data(),
+					this->thermal_masks_sum.data(),
+					y_upper - y_lower
+				);
+		}
+
+		// reset buffer
+		std::fill(this->incremental.delta_tmp[x].begin() + window.y_lower, this->incremental.delta_tmp[x].begin() + window.y_upper, 0.0);
+	}
+
+	// reset buffer
+	for (x = window.x_lower; x < window.x_upper; x++) {
+		std::fill(this->incremental.delta_power[x].begin() + window.y_lower, this->incremental.delta_power[x].begin() + window.y_upper, 0.0);
 	}
 }
 
+void ThermalAnalyzer::memorizeIncrementalState(BlocksGeometry const& blocks, std::vector<TSV_Island> const& TSVs) {
+
+	this->incremental.blocks = blocks;
+
+	this->memorizeTSVIslands(TSVs, this->incremental.TSVs);
+}
+
+void ThermalAnalyzer::memorizeTSVIslands(std::vector<TSV_Island> const& TSVs, std::vector< std::pair< int, std::array<double, 4> > >& islands) const {
+
+	islands.clear();
+	for (TSV_Island const& TSV_group : TSVs) {
+		islands.push_back({TSV_group.layer, {{TSV_group.bb.ll.x, TSV_group.bb.ll.y, TSV_group.bb.ur.x, TSV_group.bb.ur.y}}});
+	}
+
+	std::sort(islands.begin(), islands.end());
+}
+
 // Thermal-analyzer routine based on power blurring,
 // i.e., convolution of thermals masks and power maps into thermal maps.
 // Based on a separated convolution using separated 2D gauss function, i.e., 1D gauss
@@ -570,30 +1228,27 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, std::vector<TSV_Island>
 // Returns thermal map of lowest layer, i.e., hottest layer
 void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const& layers, MaskParameters const& parameters) {
 	int layer;
-	int x, y, i;
-	int map_x, map_y;
-	int mask_i;
-	double max_temp, avg_temp;
-	// required as buffer for separated convolution; note that its dimensions
-	// corresponds to a power map, which is required to hold temporary results for 1D
-	// convolution of padded power maps
-	std::array< std::array<double, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> thermal_map_tmp;
+	int x;
+	int m;
+	// input rows for convolution kernels
+	std::array<double const*, ThermalAnalyzer::THERMAL_MASK_DIM> rows;
+
+	// profiling
+	PhaseTimers::Scope phase_timer(PhaseTimers::PERFORM_POWER_BLURRING);
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "-> ThermalAnalyzer::performPowerBlurring(" << &ret << ", " << ", " << layers << ", " << &parameters << ")" << std::endl;
 	}
 
 	// init temp map w/ zero
-	for (auto& m : thermal_map_tmp) {
-		m.fill(0.0);
+	for (auto& row : this->thermal_map_tmp) {
+		std::fill(row.begin(), row.end(), 0.0);
 	}
 
 	// init final map w/ temperature offset; offset is a additive factor, and thus not
 	// considered during convolution
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-			this->thermal_map[x][y].temp = parameters.temp_offset;
-		}
+	for (auto& row : this->thermal_map_final) {
+		std::fill(row.begin(), row.end(), parameters.temp_offset);
 	}
 
 	/// perform 2D convolution by performing two separated 1D convolution iterations;
@@ -607,54 +1262,40 @@ void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const
 		// walk the full y-dimension related to the padded power map in order to
 		// reasonably model the thermal effect in the padding zone during
 		// subsequent vertical convolution
-		for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-
-			// for the x-dimension during horizontal convolution, we need to
-			// restrict the considered range according to the thermal map in
-			// order to exploit the padded power map w/o mask boundary checks
-			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-
-				// perform horizontal 1D convolution, i.e., multiply
-				// input[x] w/ mask
-				//
-				// e.g., for x = 0, THERMAL_MASK_DIM = 3
-				// convol1D(x=0) = input[-1] * mask[0] + input[0] * mask[1] + input[1] * mask[2]
-				//
-				// can be also illustrated by aligning and multiplying
-				// both arrays:
-				// input array (power map); unpadded view
-				// |x=-1|x=0|x=1|x=2|
-				// input array (power map); padded, real view
-				// |x=0 |x=1|x=2|x=3|
-				// mask:
-				// |m=0 |m=1|m=2|
-				//
-				for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
-
-					// determine power-map index; note that it is not
-					// out of range due to the padded power maps
-					i = x + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER);
-
-					if (ThermalAnalyzer::DBG) {
-
-						// mass of dbg messages; only for insane
-						// flag
-						if (ThermalAnalyzer::DBG_INSANE) {
-							std::cout << "DBG> y=" << y << ", x=" << x << ", mask_i=" << mask_i << ", i=" << i << std::endl;
-						}
-
-						if (i < 0 || i >= ThermalAnalyzer::POWER_MAPS_DIM) {
-							std::cout << "DBG> Convolution data error; i out of range (should be limited by x)" << std::endl;
-						}
-					}
-
-					// convolution; multiplication of mask element and
-					// power-map bin
-					thermal_map_tmp[x][y] +=
-						this->power_maps[layer][i][y].power_density *
-						this->thermal_masks[layer][mask_i];
-				}
+		//
+		// for the x-dimension during horizontal convolution, we need to
+		// restrict the considered range according to the thermal map in
+		// order to exploit the padded power map w/o mask boundary checks
+		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+
+			// perform horizontal 1D convolution, i.e., multiply
+			// input[x] w/ mask, for the whole row of y-values at once
+			//
+			// e.g., for x = 0, THERMAL_MASK_DIM = 3
+			// convol1D(x=0) = input[-1] * mask[0] + input[0] * mask[1] + input[1] * mask[2]
+			//
+			// can be also illustrated by aligning and multiplying
+			// both arrays:
+			// input array (power map); unpadded view
+			// |x=-1|x=0|x=1|x=2|
+			// input array (power map); padded, real view
+			// |x=0 |x=1|x=2|x=3|
+			// mask:
+			// |m=0 |m=1|m=2|
+			//
+			// the input rows are consecutive rows of the power map;
+			// note that they are not out of range due to the padded
+			// power maps
+			for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+				rows[m] = this->power_maps[layer].power_density[x - ThermalAnalyzer::THERMAL_MASK_CENTER + m].data();
 			}
+
+			this->convolution_kernel_horizontal(
+					this->thermal_map_tmp[x].data(),
+					rows.data(),
+					this->thermal_masks[layer].data(),
+					this->power_maps_dim
+				);
 		}
 	}
 
@@ -665,57 +1306,55 @@ void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const
 
 		// walk power-map grid for vertical convolution; convolute mask w/ data
 		// obtained by horizontal convolution (thermal_map_tmp)
-		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-
-			// index for final thermal map, considers padding offset
-			map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
-
-			for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
-
-				// index for final thermal map, considers padding offset
-				map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
-
-				// perform 1D vertical convolution
-				for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < this->thermal_map_dim + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+
+			// perform 1D vertical convolution, for the whole row of
+			// y-values of the final thermal map at once; the input rows
+			// are the temp thermal map's row, offset by one for each mask
+			// element; note that the first output y-value maps to the
+			// first padded y-value, thus the offset cancels out w/ the mask
+			// center
+			for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+				rows[m] = this->thermal_map_tmp[x].data() + m;
+			}
 
-					// determine power-map index; note that it is not
-					// out of range due to the temp thermal map (sized
-					// like the padded power map)
-					i = y + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER);
+			this->convolution_kernel_vertical(
+					this->thermal_map_final[x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS].data(),
+					rows.data(),
+					this->thermal_masks[layer].data(),
+					this->thermal_map_dim
+				);
+		}
+	}
 
-					if (ThermalAnalyzer::DBG) {
+	// store results into final thermal map, determine cost
+	this->determThermalMapResult(ret, parameters);
 
-						// mass of dbg messages; only for insane
-						// flag
-						if (ThermalAnalyzer::DBG_INSANE) {
-							std::cout << "DBG> x=" << x << ", y=" << y << ", map_x=" << map_x << ", map_y=" << map_y;
-							std::cout << ", mask_i=" << mask_i << ", i=" << i << std::endl;
-						}
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "<- ThermalAnalyzer::performPowerBlurring" << std::endl;
+	}
+}
 
-						if (i < 0 || i >= ThermalAnalyzer::POWER_MAPS_DIM) {
-							std::cout << "DBG> Convolution data error; i out of range (should be limited by y)" << std::endl;
-						}
-					}
+void ThermalAnalyzer::determThermalMapResult(ThermalAnalysisResult& ret, MaskParameters const& parameters) {
+	int x, y;
+	double max_temp, avg_temp;
 
-					// convolution; multiplication of mask element and
-					// power-map bin
-					this->thermal_map[map_x][map_y].temp +=
-						thermal_map_tmp[x][i] *
-						this->thermal_masks[layer][mask_i];
-				}
-			}
+	// store results into final thermal map
+	for (x = 0; x < this->thermal_map_dim; x++) {
+		for (y = 0; y < this->thermal_map_dim; y++) {
+			this->thermal_map[x][y].temp = this->thermal_map_final[x][y];
 		}
 	}
 
 	// determine max and avg value
 	max_temp = avg_temp = 0.0;
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < this->thermal_map_dim; x++) {
+		for (y = 0; y < this->thermal_map_dim; y++) {
 			max_temp = std::max(max_temp, this->thermal_map[x][y].temp);
 			avg_temp += this->thermal_map[x][y].temp;
 		}
 	}
-	avg_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+	avg_temp /= std::pow(this->thermal_map_dim, 2);
 
 	// determine cost: max temp estimation, weighted w/ avg temp
 	ret.cost_temp = avg_temp * max_temp;
@@ -725,8 +1364,172 @@ void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const
 	ret.temp_offset = parameters.temp_offset;
 	// also link whole thermal map to result
 	ret.thermal_map = &this->thermal_map;
+}
 
-	if (ThermalAnalyzer::DBG_CALLS) {
-		std::cout << "<- ThermalAnalyzer::performPowerBlurring" << std::endl;
+// power-blurring kernels; 1D convolution of THERMAL_MASK_DIM input rows w/ the mask,
+// i.e., out[y] += in[m][y] * mask[m] for all mask elements m; note that the mask
+// elements are always accumulated in the same order, such that all kernels provide the
+// same results; for COUNT > 0, the count of elements is fixed during compile time
+template<unsigned COUNT>
+void ThermalAnalyzer::convolutionKernelScalar(double* out, double const* const* in, double const* mask, unsigned const& count) {
+	unsigned const n = (COUNT > 0) ? COUNT : count;
+	unsigned y;
+	int m;
+	double sum;
+
+	for (y = 0; y < n; y++) {
+
+		sum = out[y];
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			sum += in[m][y] * mask[m];
+		}
+
+		out[y] = sum;
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+template<unsigned COUNT>
+__attribute__((target("avx2")))
+void ThermalAnalyzer::convolutionKernelAVX2(double* out, double const* const* in, double const* mask, unsigned const& count) {
+	unsigned const n = (COUNT > 0) ? COUNT : count;
+	unsigned y;
+	int m;
+	__m256d sum;
+	double sum_scalar;
+
+	// vectorized, 4 elements at once
+	for (y = 0; y + 4 <= n; y += 4) {
+
+		sum = _mm256_loadu_pd(out + y);
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			// separate mul and add, not fused, in order to provide the
+			// same results as the scalar kernel
+			sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_loadu_pd(in[m] + y), _mm256_set1_pd(mask[m])));
+		}
+
+		_mm256_storeu_pd(out + y, sum);
+	}
+
+	// remaining elements
+	for (; y < n; y++) {
+
+		sum_scalar = out[y];
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			sum_scalar += in[m][y] * mask[m];
+		}
+
+		out[y] = sum_scalar;
+	}
+}
+
+template<unsigned COUNT>
+__attribute__((target("avx512f")))
+void ThermalAnalyzer::convolutionKernelAVX512(double* out, double const* const* in, double const* mask, unsigned const& count) {
+	unsigned const n = (COUNT > 0) ? COUNT : count;
+	unsigned y;
+	int m;
+	__m512d sum;
+	__m256d sum_half;
+	double sum_scalar;
+
+	// vectorized, 8 elements at once
+	for (y = 0; y + 8 <= n; y += 8) {
+
+		sum = _mm512_loadu_pd(out + y);
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			// separate mul and add, not fused, in order to provide the
+			// same results as the scalar kernel
+			sum = _mm512_add_pd(sum, _mm512_mul_pd(_mm512_loadu_pd(in[m] + y), _mm512_set1_pd(mask[m])));
+		}
+
+		_mm512_storeu_pd(out + y, sum);
+	}
+
+	// remaining elements; 4 elements at once, if possible, then one by one
+	if (y + 4 <= n) {
+
+		sum_half = _mm256_loadu_pd(out + y);
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			sum_half = _mm256_add_pd(sum_half, _mm256_mul_pd(_mm256_loadu_pd(in[m] + y), _mm256_set1_pd(mask[m])));
+		}
+
+		_mm256_storeu_pd(out + y, sum_half);
+
+		y += 4;
+	}
+	for (; y < n; y++) {
+
+		sum_scalar = out[y];
+
+		for (m = 0; m < ThermalAnalyzer::THERMAL_MASK_DIM; m++) {
+			sum_scalar += in[m][y] * mask[m];
+		}
+
+		out[y] = sum_scalar;
+	}
+}
+
+#else
+
+// fallback for other architectures
+template<unsigned COUNT>
+void ThermalAnalyzer::convolutionKernelAVX2(double* out, double const* const* in, double const* mask, unsigned const& count) {
+	ThermalAnalyzer::convolutionKernelScalar<COUNT>(out, in, mask, count);
+}
+template<unsigned COUNT>
+void ThermalAnalyzer::convolutionKernelAVX512(double* out, double const* const* in, double const* mask, unsigned const& count) {
+	ThermalAnalyzer::convolutionKernelScalar<COUNT>(out, in, mask, count);
+}
+
+#endif
+
+template<unsigned COUNT>
+ThermalAnalyzer::ConvolutionKernel ThermalAnalyzer::convolutionKernel(std::string const& ISA) {
+
+	if (ISA == "AVX-512") {
+		return ThermalAnalyzer::convolutionKernelAVX512<COUNT>;
+	}
+	else if (ISA == "AVX2") {
+		return ThermalAnalyzer::convolutionKernelAVX2<COUNT>;
+	}
+	else {
+		return ThermalAnalyzer::convolutionKernelScalar<COUNT>;
+	}
+}
+
+// specialized kernels for common map dimensions, i.e., for thermal maps and padded
+// power maps of 32, 64, 128, and 256 bins; generic kernel otherwise
+ThermalAnalyzer::ConvolutionKernel ThermalAnalyzer::convolutionKernel(std::string const& ISA, int const& count, bool& specialized) {
+	static constexpr unsigned PAD = ThermalAnalyzer::THERMAL_MASK_DIM - 1;
+
+	specialized = true;
+
+	switch (count) {
+		case 32:
+			return ThermalAnalyzer::convolutionKernel<32>(ISA);
+		case 32 + PAD:
+			return ThermalAnalyzer::convolutionKernel<32 + PAD>(ISA);
+		case 64:
+			return ThermalAnalyzer::convolutionKernel<64>(ISA);
+		case 64 + PAD:
+			return ThermalAnalyzer::convolutionKernel<64 + PAD>(ISA);
+		case 128:
+			return ThermalAnalyzer::convolutionKernel<128>(ISA);
+		case 128 + PAD:
+			return ThermalAnalyzer::convolutionKernel<128 + PAD>(ISA);
+		case 256:
+			return ThermalAnalyzer::convolutionKernel<256>(ISA);
+		case 256 + PAD:
+			return ThermalAnalyzer::convolutionKernel<256 + PAD>(ISA);
+		default:
+			specialized = false;
+			return ThermalAnalyzer::convolutionKernel<0>(ISA);
 	}
 }
@@ -27,6 +27,7 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Block.hpp"
+#include "BlocksGeometry.hpp"
 // forward declarations, if any
 class Point;
 class Net;
@@ -38,12 +39,15 @@ class ThermalAnalyzer {
 		static constexpr bool DBG_CALLS = false;
 		static constexpr bool DBG = false;
 		static constexpr bool DBG_INSANE = false;
+		static constexpr bool DBG_INCREMENTAL = false;
+		static constexpr bool DBG_RASTER = false;
 
 	// public data
 	public:
 
 		// thermal modeling: dimensions
-		// represents the thermal map's dimension
+		// represents the thermal map's default dimension; the actual dimension
+		// is configurable, see thermal_map_dim
 		static constexpr int THERMAL_MAP_DIM = 64;
 		// represents the thermal mask's dimension (i.e., the 2D gauss function
 		// representing the thermal impulse response);
@@ -54,10 +58,6 @@ class ThermalAnalyzer {
 		static constexpr int THERMAL_MASK_CENTER = THERMAL_MASK_DIM / 2;
 		// represents the amount of padded bins at power maps' boundaries
 		static constexpr int POWER_MAPS_PADDED_BINS = THERMAL_MASK_CENTER;
-		// represents the power maps' dimension
-		// (note that maps are padded at the boundaries according to mask
-		// dim in order to handle boundary values for convolution)
-		static constexpr int POWER_MAPS_DIM = THERMAL_MAP_DIM + (THERMAL_MASK_DIM - 1);
 
 		// flags for hotspot detection
 		static constexpr int HOTSPOT_BACKGROUND = -1;
@@ -74,9 +74,12 @@ class ThermalAnalyzer {
 			double power_density_scaling_TSV_region;
 			double temp_offset;
 		};
-		struct PowerMapBin {
-			double power_density;
-			double TSV_density;
+		// power map for one layer; power and TSV densities are held in separate
+		// planes [x][y], i.e., SoA layout w/ contiguous rows, which enables
+		// vectorized power blurring
+		struct PowerMap {
+			std::vector< std::vector<double> > power_density;
+			std::vector< std::vector<double> > TSV_density;
 		};
 		struct ThermalMapBin {
 			double temp;
@@ -90,7 +93,7 @@ class ThermalAnalyzer {
 			double cost_temp;
 			double max_temp;
 			double temp_offset;
-			std::array< std::array<ThermalMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> *thermal_map = nullptr;
+			std::vector< std::vector<ThermalMapBin> > *thermal_map = nullptr;
 		};
 
 	// private data, functions
@@ -103,11 +106,88 @@ class ThermalAnalyzer {
 		// considering heat source in layer 1 and so forth.  Note that the masks
 		// are only 1D for the separated convolution.
 		std::vector< std::array<double, THERMAL_MASK_DIM> > thermal_masks;
-		// power_maps[i][x][y], whereas power_maps[0] relates to the map for layer
-		// 0 and so forth.
-		std::vector< std::array< std::array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> > power_maps;
+		// power_maps[i].power_density[x][y], whereas power_maps[0] relates to the
+		// map for layer 0 and so forth.
+		std::vector<PowerMap> power_maps;
 		// thermal map for layer 0 (lowest layer), i.e., hottest layer
-		std::array< std::array<ThermalMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> thermal_map;
+		std::vector< std::vector<ThermalMapBin> > thermal_map;
+		// buffers for separated convolution; the temp map's dimensions
+		// correspond to a power map, which is required to hold temporary
+		// results for 1D convolution of padded power maps; the final map
+		// holds the convolution results w/ contiguous rows, in contrast to
+		// the thermal map itself
+		std::vector< std::vector<double> > thermal_map_tmp, thermal_map_final;
+
+		// thermal modeling: kernels for power blurring; 1D convolution of
+		// THERMAL_MASK_DIM input rows w/ the mask, accumulated into the output
+		// row, for count elements; the kernels to be used are selected during
+		// runtime according to the available CPU features and the map
+		// dimensions; the template parameter COUNT provides kernels w/ fixed
+		// count of elements, COUNT = 0 refers to the generic kernels
+		typedef void (*ConvolutionKernel)(double* out, double const* const* in, double const* mask, unsigned const& count);
+		ConvolutionKernel convolution_kernel_horizontal = nullptr;
+		ConvolutionKernel convolution_kernel_vertical = nullptr;
+		template<unsigned COUNT>
+		static void convolutionKernelScalar(double* out, double const* const* in, double const* mask, unsigned const& count);
+		template<unsigned COUNT>
+		static void convolutionKernelAVX2(double* out, double const* const* in, double const* mask, unsigned const& count);
+		template<unsigned COUNT>
+		static void convolutionKernelAVX512(double* out, double const* const* in, double const* mask, unsigned const& count);
+		// kernel selection, for given ISA (``AVX-512'', ``AVX2'' or ``scalar'')
+		// and count of elements
+		template<unsigned COUNT>
+		static ConvolutionKernel convolutionKernel(std::string const& ISA);
+		static ConvolutionKernel convolutionKernel(std::string const& ISA, int const& count, bool& specialized);
+
+		// thermal modeling: sum of all thermal masks; the vertical convolution
+		// is applied to the horizontally convolved maps of all layers, i.e.,
+		// is equal to one vertical convolution w/ the summed-up masks
+		std::array<double, THERMAL_MASK_DIM> thermal_masks_sum;
+		// kernel for arbitrary count of elements, for windows of maps
+		ConvolutionKernel convolution_kernel_generic = nullptr;
+
+		// thermal modeling: window of power-map bins, i.e., bins [x_lower,
+		// x_upper) and [y_lower, y_upper) on given layer
+		struct MapWindow {
+			int layer;
+			int x_lower, x_upper;
+			int y_lower, y_upper;
+		};
+
+		// thermal modeling: incremental analysis; power blurring is linear, i.e.,
+		// the thermal map can be updated by blurring only the changes of the
+		// power maps; these changes are restricted to the windows covered by
+		// moved blocks and TSV islands, where the power maps are re-determined;
+		// a full analysis is performed regularly to limit numerical drift, and
+		// whenever the windows, including the zone affected by blurring, cover a
+		// notable share of the power maps
+		static constexpr unsigned INCREMENTAL_FULL_ANALYSIS_INTERVAL = 64;
+		static constexpr double INCREMENTAL_WINDOWS_AREA_LIMIT = 0.75;
+		struct IncrementalState {
+			// flag whether maps match the memorized blocks and TSV islands
+			bool valid = false;
+			// incremental updates since last full analysis
+			unsigned updates = 0;
+			// blocks and TSV islands as considered for current maps
+			BlocksGeometry blocks;
+			// TSV islands are sorted by layer and bb coordinates, in
+			// order to compare islands regardless of their order
+			std::vector< std::pair< int, std::array<double, 4> > > TSVs, TSVs_cur, TSVs_changed;
+			// windows covered by changed blocks and TSV islands
+			std::vector<MapWindow> windows;
+			// windows and offset bbs of current blocks and TSV islands
+			std::vector<MapWindow> blocks_window, TSVs_window;
+			std::vector<Rect> blocks_offset, TSVs_offset;
+			// buffers for changes of power map, and related (horizontally)
+			// convolved map; only non-zero during handling of a window
+			std::vector< std::vector<double> > delta_power, delta_tmp;
+		} incremental;
+
+		// thermal modeling: dimensions, i.e., bins in x- and y-dimension
+		// (note that power maps are padded at the boundaries according to
+		// mask dim in order to handle boundary values for convolution)
+		int thermal_map_dim = THERMAL_MAP_DIM;
+		int power_maps_dim = THERMAL_MAP_DIM + (THERMAL_MASK_DIM - 1);
 
 		// thermal modeling: parameters for generating thermal maps
 		double thermal_map_dim_x, thermal_map_dim_y;
@@ -116,8 +196,65 @@ class ThermalAnalyzer {
 		double power_maps_bin_area;
 		double blocks_offset_x, blocks_offset_y;
 		double padding_right_boundary_blocks_distance, padding_upper_boundary_blocks_distance;
-		std::array<double, POWER_MAPS_DIM + 1> power_maps_bins_ll_x, power_maps_bins_ll_y;
+		std::vector<double> power_maps_bins_ll_x, power_maps_bins_ll_y;
 		static constexpr double PADDING_ZONE_BLOCKS_DISTANCE_LIMIT = 0.01;
+
+		// power-maps helper: determine window of power-map bins covered by
+		// block's / TSV island's bb; also determines the related bb, offset into
+		// the padded power maps
+		MapWindow determBlockWindow(Rect const& bb, int const& layer, Point const& die_outline, bool const& extend_boundary_blocks_into_padding_zone, Rect& block_offset) const;
+		MapWindow determTSVIslandWindow(Rect const& bb, int const& layer, Rect& TSV_group_offset) const;
+		// power-maps helper: map block's power density / TSV island's TSV
+		// density onto map, only for bins w/in given window
+		void mapBlock(std::vector< std::vector<double> >& map, double const& power_density, Rect const& block_offset, MapWindow const& block_window, MapWindow const& window, MaskParameters const& parameters) const;
+		void mapTSVIsland(std::vector< std::vector<double> >& map, Rect const& TSV_group_offset, MapWindow const& TSV_group_window, MapWindow const& window) const;
+
+		// power-maps helper: rasterization of whole maps, used for full analysis;
+		// the coverage of bins by a bb is separable, i.e., the product of the
+		// x- and y-coverage, and it is constant w/in the bb's window except for
+		// the boundary rows/columns; each bb is thus accumulated as (up to) 3x3
+		// rectangles of constant value into 2D difference arrays, one for each
+		// layer, and the maps are derived by one prefix-sum pass per layer;
+		// this way, the effort is linear in the count of bbs and bins, instead
+		// of determining intersections for all boundary bins of all bbs
+		struct RasterSegment {
+			// bins [lower, upper) w/ same coverage
+			int lower, upper;
+			double coverage;
+		};
+		// difference arrays, flattened w/ (power_maps_dim + 1)^2 entries
+		std::vector< std::vector<double> > raster;
+		// relative limit for rounding residue of prefix sums, w.r.t. a layer's
+		// max value; smaller values are considered as zero
+		static constexpr double RASTER_RESIDUE_EPSILON = 1.0e-9;
+		void initRaster(int const& layers);
+		int determRasterSegments(std::array<RasterSegment, 3>& segments, int const& lower, int const& upper, double const& bb_lower, double const& bb_upper,
+				std::vector<double> const& bins_ll, double const& bin_dim) const;
+		void rasterize(int const& layer, Rect const& offset, MapWindow const& bb_window, double const& value);
+		void addRaster(std::vector< std::vector<double> >& map, int const& layer, double const& padding_zone_scaling);
+		void checkRaster(std::vector< std::vector<double> > const& map, std::vector< std::vector<double> > const& reference, int const& layer, std::string const& map_type) const;
+		// power-maps helper: adapt power density of bin according to TSV density
+		inline static double adaptPowerDensity(double const& power_density, double const& TSV_density, MaskParameters const& parameters) {
+
+			// ignore cases w/o TSVs
+			if (TSV_density == 0.0) {
+				return power_density;
+			}
+
+			// scaling depends on TSV density; the larger the TSV density, the
+			// larger the power down-scaling; note that the factor
+			// power_density_scaling_TSV_region ranges b/w 0.0 and 1.0, whereas
+			// TSV_density ranges b/w 0.0 and 100.0
+			return power_density * (1.0 + ((parameters.power_density_scaling_TSV_region - 1.0) / 100.0) * TSV_density);
+		}
+
+		// incremental analysis: helpers
+		bool determChangedWindows(int const& layers, BlocksGeometry const& blocks, std::vector<TSV_Island> const& TSVs, Point const& die_outline);
+		void updateWindow(MapWindow const& window, BlocksGeometry const& blocks, MaskParameters const& parameters);
+		void memorizeIncrementalState(BlocksGeometry const& blocks, std::vector<TSV_Island> const& TSVs);
+		void memorizeTSVIslands(std::vector<TSV_Island> const& TSVs, std::vector< std::pair< int, std::array<double, 4> > >& islands) const;
+		void determThermalMapResult(ThermalAnalysisResult& ret, MaskParameters const& parameters);
+
 		/// material parameters for thermal 3D-IC simulation using HotSpot
 		/// Note: properties for heat spread and heat sink also from [Park09] (equal default
 		/// HotSpot configuration values)
@@ -219,16 +356,43 @@ class ThermalAnalyzer {
 	// public data, functions
 	public:
 		friend class IO;
+		friend class ThermalSolver;
+
+		// setter; map dimension to be set before any init handler is called
+		inline void setThermalMapDim(int const& dim) {
+			this->thermal_map_dim = dim;
+			this->power_maps_dim = dim + (ThermalAnalyzer::THERMAL_MASK_DIM - 1);
+		};
+		// getter
+		inline int const& getThermalMapDim() const {
+			return this->thermal_map_dim;
+		};
+		// getter; TSV density [%] of thermal-map bin, i.e., w/o padding zone
+		inline double const& getTSVDensity(int const& layer, int const& x, int const& y) const {
+			return this->power_maps[layer].TSV_density[x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS];
+		};
+		inline std::vector<PowerMap> const& getPowerMaps() const {
+			return this->power_maps;
+		};
 
 		// thermal modeling: handlers
 		void initThermalMasks(int const& layers, bool const& log, MaskParameters const& parameters);
 		void initThermalMap(Point const& die_outline);
 		void initPowerMaps(int const& layers, Point const& die_outline);
-		void generatePowerMaps(int const& layers, std::vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone = true);
+		void generatePowerMaps(int const& layers, BlocksGeometry const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone = true);
 		void adaptPowerMaps(int const& layers, std::vector<TSV_Island> const& TSVs, std::vector<Net> const& nets, MaskParameters const& parameters);
+		// derive power maps from unscaled power maps, i.e., from maps generated
+		// and adapted w/ both power-density scaling factors set to 1.0; the
+		// scaling factors are linear for each bin, thus the maps must not be
+		// regenerated for varying factors (parameter fitting)
+		void scalePowerMaps(int const& layers, std::vector<PowerMap> const& unscaled_power_maps, MaskParameters const& parameters);
 		// thermal-analyzer routine based on power blurring,
 		// i.e., convolution of thermals masks and power maps
 		void performPowerBlurring(ThermalAnalysisResult& ret, int const& layers, MaskParameters const& parameters);
+		// thermal-analyzer routine, incremental w/ respect to the previous call,
+		// if possible; otherwise, power maps are generated and blurred as a
+		// whole
+		void performThermalAnalysis(ThermalAnalysisResult& ret, int const& layers, BlocksGeometry const& blocks, std::vector<TSV_Island> const& TSVs, std::vector<Net> const& nets, Point const& die_outline, MaskParameters const& parameters, bool const& incremental = true);
 };
 
 #endif
@@ -0,0 +1,533 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar steady-state thermal solver (finite-difference method)
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "ThermalSolver.hpp"
+// required Corblivar headers
+#include "Point.hpp"
+#include "Rect.hpp"
+#include "Math.hpp"
+#include "ThermalAnalyzer.hpp"
+
+// memory allocation
+constexpr unsigned ThermalSolver::CHUNKS;
+
+void ThermalSolver::solve(SteadyStateResult& ret, int const& layers, int const& dim, std::vector<Block> const& blocks, Point const& die_outline,
+		Parameters const& parameters, std::function<double(int const& layer, int const& x, int const& y)> const& TSV_density) {
+	int x, y;
+	int i;
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "-> ThermalSolver::solve(" << &ret << ", " << layers << ", " << dim << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), " << &parameters << ")" << std::endl;
+	}
+
+	// (re-)init grid, if required
+	this->initGrid(layers, dim, parameters);
+
+	// setup system
+	this->determPower(blocks, die_outline);
+	this->determConductances(die_outline, parameters, TSV_density);
+	this->determPreconditioner();
+
+	// solve system
+	this->solveCG(ret);
+
+	// store temperatures of active Si layers
+	ret.temp.resize(this->layers);
+	ret.max_temp = ret.max_temp_stack = 0.0;
+
+	for (i = 0; i < this->layers; i++) {
+
+		ret.temp[i].resize(this->dim);
+
+		for (x = 0; x < this->dim; x++) {
+
+			ret.temp[i][x].resize(this->dim);
+
+			for (y = 0; y < this->dim; y++) {
+
+				ret.temp[i][x][y] = ThermalSolver::AMBIENT_TEMP + this->T[this->index(x, y, ThermalSolver::LAYERS_PER_DIE * i + 1)];
+
+				ret.max_temp_stack = std::max(ret.max_temp_stack, ret.temp[i][x][y]);
+				if (i == 0) {
+					ret.max_temp = std::max(ret.max_temp, ret.temp[i][x][y]);
+				}
+			}
+		}
+	}
+
+	if (ThermalSolver::DBG) {
+		std::cout << "DBG_THERMAL_SOLVER> Iterations: " << ret.iterations << "; relative residual: " << ret.residual << "; converged: " << ret.converged << std::endl;
+		std::cout << "DBG_THERMAL_SOLVER> Max temp (lowest layer): " << ret.max_temp << "; max temp (stack): " << ret.max_temp_stack << std::endl;
+	}
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "<- ThermalSolver::solve" << std::endl;
+	}
+}
+
+void ThermalSolver::initGrid(int const& layers, int const& dim, Parameters const& parameters) {
+	int i;
+	unsigned chunks;
+
+	// grid dimensions; for changed dimensions, previous temperatures are not
+	// reasonable starting point anymore
+	if (this->layers != layers || this->dim != dim) {
+		this->T_valid = false;
+	}
+
+	this->layers = layers;
+	this->dim = dim;
+	// each die consists of BEOL, active Si, passive Si and bonding layer, whereas
+	// the uppermost die has no bonding layer; additional package layers for heat
+	// spreader and heat sink, similar to HotSpot files
+	this->grid_layers = ThermalSolver::LAYERS_PER_DIE * layers - 1 + ThermalSolver::LAYERS_PACKAGE;
+	this->cells = static_cast<unsigned>(dim) * dim * this->grid_layers;
+
+	// thickness of grid layers, convert um to m
+	this->thickness.assign(this->grid_layers, 0.0);
+	for (i = 0; i < layers; i++) {
+
+		this->thickness[ThermalSolver::LAYERS_PER_DIE * i] = parameters.BEOL_thickness * Math::SCALE_UM_M;
+		this->thickness[ThermalSolver::LAYERS_PER_DIE * i + 1] = parameters.Si_active_thickness * Math::SCALE_UM_M;
+		this->thickness[ThermalSolver::LAYERS_PER_DIE * i + 2] = parameters.Si_passive_thickness * Math::SCALE_UM_M;
+
+		if (i < layers - 1) {
+			this->thickness[ThermalSolver::LAYERS_PER_DIE * i + 3] = parameters.bond_thickness * Math::SCALE_UM_M;
+		}
+	}
+	this->thickness[this->grid_layers - 2] = ThermalSolver::SPREADER_THICKNESS;
+	this->thickness[this->grid_layers - 1] = ThermalSolver::HEATSINK_THICKNESS;
+
+	// allocate system and vectors
+	this->resistivity.resize(this->cells);
+	this->power.resize(this->cells);
+	this->G_x.resize(this->cells);
+	this->G_y.resize(this->cells);
+	this->G_z.resize(this->cells);
+	this->G_diag.resize(this->cells);
+	this->precond_c.resize(this->cells);
+	this->precond_denom.resize(this->cells);
+	this->r.resize(this->cells);
+	this->z.resize(this->cells);
+	this->p.resize(this->cells);
+	this->q.resize(this->cells);
+
+	if (!this->T_valid) {
+		this->T.assign(this->cells, 0.0);
+	}
+
+	// init worker threads on first run
+	chunks = std::min(ThermalSolver::CHUNKS, static_cast<unsigned>(this->dim));
+
+	if (!this->pool) {
+		this->pool.reset(new ThreadPool(std::min(chunks, std::thread::hardware_concurrency()), 0));
+	}
+
+	this->partial_1.resize(chunks);
+	this->partial_2.resize(chunks);
+}
+
+void ThermalSolver::parallel(std::function<void(int const& x_lower, int const& x_upper, unsigned const& chunk)> const& task) {
+	unsigned chunks = this->partial_1.size();
+
+	this->pool->run(chunks, [&](unsigned const& chunk) {
+			task(chunk * this->dim / chunks, (chunk + 1) * this->dim / chunks, chunk);
+		});
+}
+
+// heat sources, i.e., blocks' power mapped to the bins of the active Si layers
+void ThermalSolver::determPower(std::vector<Block> const& blocks, Point const& die_outline) {
+	int x, y;
+	int x_lower, x_upper, y_lower, y_upper;
+	double bin_w, bin_h;
+	double block_power;
+	Rect bin, intersect;
+
+	std::fill(this->power.begin(), this->power.end(), 0.0);
+
+	bin_w = die_outline.x / this->dim;
+	bin_h = die_outline.y / this->dim;
+
+	for (Block const& block : blocks) {
+
+		// sanity check for empty blocks
+		if (block.bb.area == 0.0) {
+			continue;
+		}
+
+		block_power = block.power();
+
+		// determine index boundaries for block; cast to int truncates toward
+		// zero, i.e., performs like floor for positive numbers; +1 in order to
+		// efficiently emulate the result of ceil(); limit bounds to grid
+		x_lower = std::max(0, static_cast<int>(block.bb.ll.x / bin_w));
+		y_lower = std::max(0, static_cast<int>(block.bb.ll.y / bin_h));
+		x_upper = std::min(static_cast<int>(block.bb.ur.x / bin_w) + 1, this->dim);
+		y_upper = std::min(static_cast<int>(block.bb.ur.y / bin_h) + 1, this->dim);
+
+		for (x = x_lower; x < x_upper; x++) {
+			for (y = y_lower; y < y_upper; y++) {
+
+				bin.ll.x = x * bin_w;
+				bin.ll.y = y * bin_h;
+				bin.ur.x = (x + 1) * bin_w;
+				bin.ur.y = (y + 1) * bin_h;
+
+				intersect = Rect::determineIntersection(bin, block.bb);
+
+				// consider power share according to intersection
+				this->power[this->index(x, y, ThermalSolver::LAYERS_PER_DIE * block.layer + 1)] += block_power * (intersect.area / block.bb.area);
+			}
+		}
+	}
+}
+
+// thermal conductances b/w bins; derived from series resistances of adjacent half
+// bins
+void ThermalSolver::determConductances(Point const& die_outline, Parameters const& parameters, std::function<double(int const& layer, int const& x, int const& y)> const& TSV_density) {
+	int x, y;
+	int i, l;
+	unsigned ii;
+	double bin_w, bin_h, bin_area, die_area;
+	double G_ambient;
+	std::vector<double> area;
+
+	// bin dimensions, convert um to m
+	bin_w = die_outline.x * Math::SCALE_UM_M / this->dim;
+	bin_h = die_outline.y * Math::SCALE_UM_M / this->dim;
+	bin_area = bin_w * bin_h;
+	die_area = bin_area * this->dim * this->dim;
+
+	// cross-sections of bins for vertical conduction; for heat spreader and heat
+	// sink, the bins' share of the actual (larger) cross-section is considered
+	area.assign(this->grid_layers, bin_area);
+	area[this->grid_layers - 2] = bin_area * std::max(1.0, (ThermalSolver::SPREADER_SIDE * ThermalSolver::SPREADER_SIDE) / die_area);
+	area[this->grid_layers - 1] = bin_area * std::max(1.0, (ThermalSolver::HEATSINK_SIDE * ThermalSolver::HEATSINK_SIDE) / die_area);
+
+	// conductance of bin to ambient; the whole heat sink's convection resistance
+	// is distributed over the bins
+	G_ambient = 1.0 / (ThermalSolver::HEATSINK_CONVECTION_RESISTANCE * this->dim * this->dim);
+
+	// thermal resistivities of bins
+	for (x = 0; x < this->dim; x++) {
+		for (y = 0; y < this->dim; y++) {
+
+			for (i = 0; i < this->layers; i++) {
+
+				l = ThermalSolver::LAYERS_PER_DIE * i;
+
+				this->resistivity[this->index(x, y, l)] = ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL;
+				this->resistivity[this->index(x, y, l + 1)] = ThermalAnalyzer::THERMAL_RESISTIVITY_SI;
+				// passive Si and bonding layer; TSVs reduce the
+				// resistivity, similar to HotSpot files
+				this->resistivity[this->index(x, y, l + 2)] = ThermalAnalyzer::thermResSi(parameters.TSV_group_Cu_area_ratio, TSV_density(i, x, y));
+				if (i < this->layers - 1) {
+					this->resistivity[this->index(x, y, l + 3)] = ThermalAnalyzer::thermResBond(parameters.TSV_group_Cu_area_ratio, TSV_density(i, x, y));
+				}
+			}
+
+			this->resistivity[this->index(x, y, this->grid_layers - 2)] = ThermalSolver::THERMAL_RESISTIVITY_SPREADER;
+			this->resistivity[this->index(x, y, this->grid_layers - 1)] = ThermalSolver::THERMAL_RESISTIVITY_HEATSINK;
+		}
+	}
+
+	// conductances to neighbors in positive x-, y-, z-dimension
+	for (x = 0; x < this->dim; x++) {
+		for (y = 0; y < this->dim; y++) {
+			for (l = 0; l < this->grid_layers; l++) {
+
+				ii = this->index(x, y, l);
+
+				// lateral conductances; cross-section is bin's side times
+				// layer's thickness
+				if (x < this->dim - 1) {
+					this->G_x[ii] = (this->thickness[l] * bin_h) /
+						(0.5 * bin_w * (this->resistivity[ii] + this->resistivity[this->index(x + 1, y, l)]));
+				}
+				else {
+					this->G_x[ii] = 0.0;
+				}
+
+				if (y < this->dim - 1) {
+					this->G_y[ii] = (this->thickness[l] * bin_w) /
+						(0.5 * bin_h * (this->resistivity[ii] + this->resistivity[this->index(x, y + 1, l)]));
+				}
+				else {
+					this->G_y[ii] = 0.0;
+				}
+
+				// vertical conductance; series of half bins
+				if (l < this->grid_layers - 1) {
+					this->G_z[ii] = 1.0 /
+						(0.5 * this->thickness[l] * this->resistivity[ii] / area[l] + 0.5 * this->thickness[l + 1] * this->resistivity[ii + 1] / area[l + 1]);
+				}
+				else {
+					this->G_z[ii] = 0.0;
+				}
+			}
+		}
+	}
+
+	// diagonal, i.e., sum of conductances to all neighbors
+	for (x = 0; x < this->dim; x++) {
+		for (y = 0; y < this->dim; y++) {
+			for (l = 0; l < this->grid_layers; l++) {
+
+				ii = this->index(x, y, l);
+
+				this->G_diag[ii] = this->G_x[ii] + this->G_y[ii] + this->G_z[ii];
+
+				if (x > 0) {
+					this->G_diag[ii] += this->G_x[this->index(x - 1, y, l)];
+				}
+				if (y > 0) {
+					this->G_diag[ii] += this->G_y[this->index(x, y - 1, l)];
+				}
+				if (l > 0) {
+					this->G_diag[ii] += this->G_z[ii - 1];
+				}
+
+				// heat sink; consider conduction through upper half of
+				// heat sink and convection to ambient
+				if (l == this->grid_layers - 1) {
+					this->G_diag[ii] += 1.0 /
+						(0.5 * this->thickness[l] * this->resistivity[ii] / area[l] + 1.0 / G_ambient);
+				}
+			}
+		}
+	}
+}
+
+// preconditioner; LU factorization of the tridiagonal matrices of vertical columns,
+// i.e., Thomas algorithm
+void ThermalSolver::determPreconditioner() {
+	int x, y;
+	int l;
+	unsigned ii;
+
+	for (x = 0; x < this->dim; x++) {
+		for (y = 0; y < this->dim; y++) {
+
+			ii = this->index(x, y, 0);
+
+			this->precond_denom[ii] = this->G_diag[ii];
+			this->precond_c[ii] = -this->G_z[ii] / this->precond_denom[ii];
+
+			for (l = 1; l < this->grid_layers; l++) {
+
+				ii++;
+
+				this->precond_denom[ii] = this->G_diag[ii] + this->G_z[ii - 1] * this->precond_c[ii - 1];
+				this->precond_c[ii] = -this->G_z[ii] / this->precond_denom[ii];
+			}
+		}
+	}
+}
+
+// preconditioned conjugate-gradient method; matrix-free, i.e., the system matrix is
+// applied via the stencil of conductances
+void ThermalSolver::solveCG(SteadyStateResult& ret) {
+	unsigned iteration;
+	unsigned c;
+	double rz, rz_prev, pq, rr, bb;
+	double alpha, beta;
+	int const stride_x = this->dim * this->grid_layers;
+	int const stride_y = this->grid_layers;
+
+	// lambda expression; q = G * v for range of rows; also returns partial dot
+	// product w * q
+	auto multiply = [&](std::vector<double> const& v, std::vector<double>& q, std::vector<double> const& w, int const& x_lower, int const& x_upper) {
+		int x, y, l;
+		unsigned ii;
+		double dot = 0.0;
+
+		for (x = x_lower; x < x_upper; x++) {
+			for (y = 0; y < this->dim; y++) {
+
+				ii = this->index(x, y, 0);
+
+				for (l = 0; l < this->grid_layers; l++, ii++) {
+
+					q[ii] = this->G_diag[ii] * v[ii];
+
+					if (x > 0) {
+						q[ii] -= this->G_x[ii - stride_x] * v[ii - stride_x];
+					}
+					if (x < this->dim - 1) {
+						q[ii] -= this->G_x[ii] * v[ii + stride_x];
+					}
+					if (y > 0) {
+						q[ii] -= this->G_y[ii - stride_y] * v[ii - stride_y];
+					}
+					if (y < this->dim - 1) {
+						q[ii] -= this->G_y[ii] * v[ii + stride_y];
+					}
+					if (l > 0) {
+						q[ii] -= this->G_z[ii - 1] * v[ii - 1];
+					}
+					if (l < this->grid_layers - 1) {
+						q[ii] -= this->G_z[ii] * v[ii + 1];
+					}
+
+					dot += w[ii] * q[ii];
+				}
+			}
+		}
+
+		return dot;
+	};
+
+	// lambda expression; z = M^-1 * r for range of rows, i.e., forward and
+	// backward substitution for vertical columns; also returns partial dot product
+	// r * z
+	auto precondition = [&](int const& x_lower, int const& x_upper) {
+		int x, y, l;
+		unsigned ii;
+		double dot = 0.0;
+
+		for (x = x_lower; x < x_upper; x++) {
+			for (y = 0; y < this->dim; y++) {
+
+				ii = this->index(x, y, 0);
+
+				this->z[ii] = this->r[ii] / this->precond_denom[ii];
+				for (l = 1; l < this->grid_layers; l++) {
+					ii++;
+					this->z[ii] = (this->r[ii] + this->G_z[ii - 1] * this->z[ii - 1]) / this->precond_denom[ii];
+				}
+				for (l = this->grid_layers - 2; l >= 0; l--) {
+					ii--;
+					this->z[ii] -= this->precond_c[ii] * this->z[ii + 1];
+				}
+
+				ii = this->index(x, y, 0);
+				for (l = 0; l < this->grid_layers; l++, ii++) {
+					dot += this->r[ii] * this->z[ii];
+				}
+			}
+		}
+
+		return dot;
+	};
+
+	// lambda expression; sum up partial results of chunks, in order
+	auto sum = [&](std::vector<double> const& partial) {
+		double ret = 0.0;
+
+		for (c = 0; c < partial.size(); c++) {
+			ret += partial[c];
+		}
+
+		return ret;
+	};
+
+	// init residual r = P - G * T, previous temperatures are starting point;
+	// preconditioned residual and search direction
+	this->parallel([&](int const& x_lower, int const& x_upper, unsigned const& chunk) {
+			unsigned ii;
+			double dot_b = 0.0;
+
+			multiply(this->T, this->q, this->q, x_lower, x_upper);
+
+			for (ii = this->index(x_lower, 0, 0); ii < this->index(x_upper, 0, 0); ii++) {
+				this->r[ii] = this->power[ii] - this->q[ii];
+				dot_b += this->power[ii] * this->power[ii];
+			}
+
+			this->partial_1[chunk] = precondition(x_lower, x_upper);
+			this->partial_2[chunk] = dot_b;
+
+			for (ii = this->index(x_lower, 0, 0); ii < this->index(x_upper, 0, 0); ii++) {
+				this->p[ii] = this->z[ii];
+			}
+		});
+
+	rz = sum(this->partial_1);
+	bb = sum(this->partial_2);
+
+	ret.iterations = 0;
+	ret.residual = 0.0;
+	ret.converged = true;
+
+	// trivial case, no heat sources
+	if (bb == 0.0) {
+		std::fill(this->T.begin(), this->T.end(), 0.0);
+		this->T_valid = true;
+
+		return;
+	}
+
+	for (iteration = 1; iteration <= ThermalSolver::CG_MAX_ITERATIONS; iteration++) {
+
+		// q = G * p, p * q
+		this->parallel([&](int const& x_lower, int const& x_upper, unsigned const& chunk) {
+				this->partial_1[chunk] = multiply(this->p, this->q, this->p, x_lower, x_upper);
+			});
+
+		pq = sum(this->partial_1);
+		alpha = rz / pq;
+
+		// update temperatures and residual; precondition residual
+		this->parallel([&](int const& x_lower, int const& x_upper, unsigned const& chunk) {
+				unsigned ii;
+				double dot_r = 0.0;
+
+				for (ii = this->index(x_lower, 0, 0); ii < this->index(x_upper, 0, 0); ii++) {
+					this->T[ii] += alpha * this->p[ii];
+					this->r[ii] -= alpha * this->q[ii];
+					dot_r += this->r[ii] * this->r[ii];
+				}
+
+				this->partial_1[chunk] = precondition(x_lower, x_upper);
+				this->partial_2[chunk] = dot_r;
+			});
+
+		rz_prev = rz;
+		rz = sum(this->partial_1);
+		rr = sum(this->partial_2);
+
+		ret.iterations = iteration;
+		ret.residual = std::sqrt(rr / bb);
+
+		if (ret.residual < ThermalSolver::CG_TOLERANCE) {
+			break;
+		}
+
+		// update search direction
+		beta = rz / rz_prev;
+
+		this->parallel([&](int const& x_lower, int const& x_upper, unsigned const&) {
+				unsigned ii;
+
+				for (ii = this->index(x_lower, 0, 0); ii < this->index(x_upper, 0, 0); ii++) {
+					this->p[ii] = this->z[ii] + beta * this->p[ii];
+				}
+			});
+	}
+
+	ret.converged = (ret.residual < ThermalSolver::CG_TOLERANCE);
+
+	// temperatures are reasonable starting point for next run
+	this->T_valid = true;
+}
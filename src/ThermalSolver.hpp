@@ -0,0 +1,167 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar steady-state thermal solver (finite-difference method)
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THERMALSOLVER
+#define _CORBLIVAR_THERMALSOLVER
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Block.hpp"
+#include "ThreadPool.hpp"
+// forward declarations, if any
+class Point;
+
+// Steady-state 3D thermal analysis, replaces external HotSpot runs for validation of
+// floorplans. The 3D-IC stack is modelled like the HotSpot grid model (see
+// IO::writeHotSpotFiles): each die consists of BEOL, active Si, passive Si and (except
+// for the uppermost die) bonding layer; the stack is covered by heat spreader and heat
+// sink. The finite-difference discretization results in a sparse, symmetric
+// positive-definite system of thermal conductances, which is solved by a
+// multithreaded, preconditioned conjugate-gradient method.
+class ThermalSolver {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+		static constexpr bool DBG_CALLS = false;
+
+	// PODs, to be declared early on
+	public:
+		struct Parameters {
+			// flag whether to solve for the final solution
+			bool final_solution;
+			// interval of SA temperature steps for solver runs during
+			// optimization; 0 deactivates these runs
+			int SA_steps_interval;
+			// technology parameters [um]
+			double Si_active_thickness;
+			double Si_passive_thickness;
+			double BEOL_thickness;
+			double bond_thickness;
+			// Cu area fraction for TSV groups
+			double TSV_group_Cu_area_ratio;
+		};
+		struct SteadyStateResult {
+			// temperatures [K] of active Si layers, i.e., temp[die][x][y]
+			std::vector< std::vector< std::vector<double> > > temp;
+			// max temperature [K] of lowest layer, i.e., hottest layer
+			double max_temp;
+			// max temperature [K] of all active Si layers
+			double max_temp_stack;
+			// CG iterations and relative residual
+			unsigned iterations;
+			double residual;
+			bool converged;
+		};
+
+	// private data, functions
+	private:
+
+		/// package parameters; default HotSpot configuration values, except for the
+		/// ambient temperature
+		//
+		// note that heat spreader and heat sink are discretized only w/in the
+		// footprint of the chip; their vertical conduction considers their
+		// actual side lengths, i.e., the lateral spreading of heat into the
+		// package periphery is approximated, and the convection resistance of the
+		// whole heat sink is distributed over the footprint
+		static constexpr double AMBIENT_TEMP = 293.15;
+		static constexpr double HEATSINK_CONVECTION_RESISTANCE = 0.1;
+		static constexpr double HEATSINK_SIDE = 60.0e-03;
+		static constexpr double HEATSINK_THICKNESS = 6.9e-03;
+		static constexpr double THERMAL_RESISTIVITY_HEATSINK = 2.5e-03;
+		static constexpr double SPREADER_SIDE = 30.0e-03;
+		static constexpr double SPREADER_THICKNESS = 1.0e-03;
+		static constexpr double THERMAL_RESISTIVITY_SPREADER = 2.5e-03;
+		// layers per die, and package layers
+		static constexpr int LAYERS_PER_DIE = 4;
+		static constexpr int LAYERS_PACKAGE = 2;
+
+		// solver parameters; CG terminates for the relative residual, i.e.,
+		// ||P - G * T|| / ||P||, being below the tolerance
+		static constexpr double CG_TOLERANCE = 1.0e-08;
+		static constexpr unsigned CG_MAX_ITERATIONS = 10000;
+		// the grid is partitioned into chunks of rows (x-dimension) for
+		// multithreading; partial results of chunks are always reduced in the
+		// same order, thus results don't depend on the count of threads
+		static constexpr unsigned CHUNKS = 16;
+
+		// grid: bins in x- and y-dimension, and grid layers; grid index of
+		// bin (x, y) on grid layer l is (x * dim + y) * grid_layers + l, i.e.,
+		// the vertical columns of bins are contiguous
+		int dim;
+		int layers, grid_layers;
+		unsigned cells;
+
+		// grid: thickness [m] of grid layers, and thermal resistivity [m*K/W]
+		// of bins
+		std::vector<double> thickness, resistivity;
+		// grid: heat sources [W]
+		std::vector<double> power;
+
+		// system matrix; conductances [W/K] to neighbor bins in positive x-,
+		// y- and z-dimension (z relates to the next upper grid layer), and
+		// diagonal, i.e., sum of all conductances of bin
+		std::vector<double> G_x, G_y, G_z, G_diag;
+
+		// preconditioner; factorized tridiagonal matrices for the vertical
+		// columns of bins, capturing the strong vertical coupling of the thin
+		// layers
+		std::vector<double> precond_c, precond_denom;
+
+		// CG vectors; temperatures are relative to ambient temperature
+		std::vector<double> T, r, z, p, q;
+		// flag whether temperatures are valid starting point for next solver run
+		bool T_valid = false;
+		// partial results of chunks
+		std::vector<double> partial_1, partial_2;
+
+		// persistent worker threads, allocated on first solver run
+		std::unique_ptr<ThreadPool> pool;
+
+		// helper for grid
+		inline unsigned index(int const& x, int const& y, int const& layer) const {
+			return (static_cast<unsigned>(x) * this->dim + y) * this->grid_layers + layer;
+		};
+
+		// helper for multithreading; task is called for each chunk, i.e., for
+		// range [x_lower, x_upper) of rows
+		void parallel(std::function<void(int const& x_lower, int const& x_upper, unsigned const& chunk)> const& task);
+
+		// helper for system setup
+		void initGrid(int const& layers, int const& dim, Parameters const& parameters);
+		void determPower(std::vector<Block> const& blocks, Point const& die_outline);
+		void determConductances(Point const& die_outline, Parameters const& parameters, std::function<double(int const& layer, int const& x, int const& y)> const& TSV_density);
+		void determPreconditioner();
+
+		// actual solver
+		void solveCG(SteadyStateResult& ret);
+
+	// public data, functions
+	public:
+		// solve for temperatures of given layout; TSV_density provides the TSV
+		// densities [%] of the thermal-map bins for each die
+		void solve(SteadyStateResult& ret, int const& layers, int const& dim, std::vector<Block> const& blocks, Point const& die_outline,
+				Parameters const& parameters, std::function<double(int const& layer, int const& x, int const& y)> const& TSV_density);
+};
+
+#endif
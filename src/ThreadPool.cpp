@@ -0,0 +1,123 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar pool of persistent worker threads
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "ThreadPool.hpp"
+// required Corblivar headers
+#include "Math.hpp"
+
+ThreadPool::ThreadPool(unsigned const& workers, unsigned const& seed) {
+
+	this->task = nullptr;
+	this->tasks = this->next_task = this->tasks_done = 0;
+	this->batch = 0;
+	this->shutdown = false;
+
+	for (unsigned w = 0; w < std::max(1u, workers); w++) {
+		this->workers.emplace_back(&ThreadPool::work, this, w, seed);
+	}
+
+	if (ThreadPool::DBG) {
+		std::cout << "DBG_THREADS> Started " << this->workers.size() << " worker threads" << std::endl;
+	}
+}
+
+ThreadPool::~ThreadPool() {
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->shutdown = true;
+	}
+	this->work_available.notify_all();
+
+	for (std::thread& worker : this->workers) {
+		worker.join();
+	}
+}
+
+void ThreadPool::run(unsigned const& tasks, std::function<void(unsigned const&)> const& task) {
+	std::unique_lock<std::mutex> lock(this->mutex);
+
+	// trivial case
+	if (tasks == 0) {
+		return;
+	}
+
+	// init new batch
+	this->task = &task;
+	this->tasks = tasks;
+	this->next_task = 0;
+	this->tasks_done = 0;
+	this->batch++;
+
+	this->work_available.notify_all();
+
+	// wait until all tasks of batch are done
+	this->work_done.wait(lock, [&]() {
+			return this->tasks_done == this->tasks;
+		});
+
+	this->task = nullptr;
+}
+
+void ThreadPool::work(unsigned const& worker, unsigned const& seed) {
+	unsigned cur_batch, cur_task;
+
+	// each worker draws its own random numbers
+	Math::initRandomNumberGenerator(seed + worker);
+
+	cur_batch = 0;
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+
+	while (true) {
+
+		// wait for new batch or shutdown
+		this->work_available.wait(lock, [&]() {
+				return this->shutdown || (this->batch != cur_batch && this->next_task < this->tasks);
+			});
+
+		if (this->shutdown) {
+			return;
+		}
+
+		// claim tasks until batch is exhausted; perform tasks unlocked
+		while (this->next_task < this->tasks) {
+
+			cur_task = this->next_task++;
+
+			lock.unlock();
+			(*this->task)(cur_task);
+			lock.lock();
+
+			this->tasks_done++;
+		}
+
+		// memorize batch as handled
+		cur_batch = this->batch;
+
+		if (this->tasks_done == this->tasks) {
+			this->work_done.notify_all();
+		}
+	}
+}
@@ -0,0 +1,72 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar pool of persistent worker threads
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THREAD_POOL
+#define _CORBLIVAR_THREAD_POOL
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+class ThreadPool {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		// persistent worker threads
+		std::vector<std::thread> workers;
+
+		// synchronization
+		std::mutex mutex;
+		std::condition_variable work_available, work_done;
+
+		// current batch of tasks; tasks are claimed by index
+		std::function<void(unsigned const&)> const* task;
+		unsigned tasks, next_task, tasks_done;
+		// batch counter; allows workers to detect new batches
+		unsigned batch;
+		bool shutdown;
+
+		// worker routine
+		void work(unsigned const& worker, unsigned const& seed);
+
+	// constructors, destructors, if any non-implicit
+	public:
+		// note that each worker seeds its own random-number generator w/ seed +
+		// worker index
+		ThreadPool(unsigned const& workers, unsigned const& seed);
+		~ThreadPool();
+
+	// public data, functions
+	public:
+		// run tasks 0 to tasks - 1 on the workers; blocks until all tasks are done
+		void run(unsigned const& tasks, std::function<void(unsigned const&)> const& task);
+
+		inline unsigned size() const {
+			return this->workers.size();
+		};
+};
+
+#endif
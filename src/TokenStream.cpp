@@ -0,0 +1,358 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar memory-mapped token stream, for parsing of benchmark files
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "TokenStream.hpp"
+// POSIX memory mapping
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+// required Corblivar headers
+
+void TokenStream::open(std::string const& file) {
+	int fd;
+	struct stat file_stat;
+	void* mapped;
+
+	this->close();
+
+	fd = ::open(file.c_str(), O_RDONLY);
+	if (fd == -1) {
+		this->eof_flag = this->fail_flag = true;
+		return;
+	}
+
+	if (fstat(fd, &file_stat) == -1) {
+		::close(fd);
+		this->eof_flag = this->fail_flag = true;
+		return;
+	}
+
+	this->mapped_size = file_stat.st_size;
+
+	// empty files cannot be mapped, but are valid nevertheless
+	if (this->mapped_size > 0) {
+
+		mapped = mmap(nullptr, this->mapped_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (mapped == MAP_FAILED) {
+			::close(fd);
+			this->mapped_size = 0;
+			this->eof_flag = this->fail_flag = true;
+			return;
+		}
+
+		// the file is read once from begin to end
+		madvise(mapped, this->mapped_size, MADV_SEQUENTIAL);
+
+		this->begin = static_cast<char const*>(mapped);
+	}
+
+	// the mapping remains valid after closing the file descriptor
+	::close(fd);
+
+	this->end = this->begin + this->mapped_size;
+	this->opened = true;
+	this->rewind();
+
+	if (TokenStream::DBG) {
+		std::cout << "DBG_TOKENSTREAM> Mapped file " << file << "; " << this->mapped_size << " bytes" << std::endl;
+	}
+}
+
+void TokenStream::close() {
+
+	if (this->begin != nullptr) {
+		munmap(const_cast<char*>(this->begin), this->mapped_size);
+	}
+
+	this->begin = this->end = this->pos = nullptr;
+	this->mapped_size = 0;
+	this->opened = false;
+	this->eof_flag = this->fail_flag = false;
+}
+
+bool TokenStream::skipWhitespaces() {
+
+	// like for std::istream, any extraction after reaching eof fails
+	if (this->fail_flag || this->eof_flag) {
+		this->fail_flag = true;
+		return false;
+	}
+
+	while (this->pos != this->end && TokenStream::whitespace(*this->pos)) {
+		this->pos++;
+	}
+
+	if (this->pos == this->end) {
+		this->eof_flag = this->fail_flag = true;
+		return false;
+	}
+
+	return true;
+}
+
+TokenStream& TokenStream::operator>>(TokenStream::Token& token) {
+	char const* first;
+
+	if (!this->skipWhitespaces()) {
+		return *this;
+	}
+
+	first = this->pos;
+	while (this->pos != this->end && !TokenStream::whitespace(*this->pos)) {
+		this->pos++;
+	}
+
+	token.data = first;
+	token.size = this->pos - first;
+
+	if (this->pos == this->end) {
+		this->eof_flag = true;
+	}
+
+	return *this;
+}
+
+TokenStream& TokenStream::operator>>(std::string& token) {
+	Token span;
+
+	*this >> span;
+
+	if (!this->fail_flag) {
+		token.assign(span.data, span.size);
+	}
+
+	return *this;
+}
+
+TokenStream& TokenStream::operator>>(double& value) {
+	bool valid;
+
+	if (!this->skipWhitespaces()) {
+		return *this;
+	}
+
+	this->pos = TokenStream::parseDouble(this->pos, this->end, value, valid);
+
+	if (!valid) {
+		value = 0.0;
+		this->fail_flag = true;
+	}
+	if (this->pos == this->end) {
+		this->eof_flag = true;
+	}
+
+	return *this;
+}
+
+TokenStream& TokenStream::operator>>(int& value) {
+	long long parsed;
+	bool valid;
+
+	if (!this->skipWhitespaces()) {
+		return *this;
+	}
+
+	this->pos = TokenStream::parseInteger(this->pos, this->end, parsed, valid);
+
+	if (valid) {
+		value = static_cast<int>(parsed);
+	}
+	else {
+		value = 0;
+		this->fail_flag = true;
+	}
+	if (this->pos == this->end) {
+		this->eof_flag = true;
+	}
+
+	return *this;
+}
+
+TokenStream& TokenStream::operator>>(unsigned& value) {
+	long long parsed;
+	bool valid;
+
+	if (!this->skipWhitespaces()) {
+		return *this;
+	}
+
+	this->pos = TokenStream::parseInteger(this->pos, this->end, parsed, valid);
+
+	if (valid) {
+		value = static_cast<unsigned>(parsed);
+	}
+	else {
+		value = 0;
+		this->fail_flag = true;
+	}
+	if (this->pos == this->end) {
+		this->eof_flag = true;
+	}
+
+	return *this;
+}
+
+char const* TokenStream::parseInteger(char const* first, char const* last, long long& value, bool& valid) {
+	bool negative = false;
+
+	value = 0;
+	valid = false;
+
+	if (first != last && (*first == '+' || *first == '-')) {
+		negative = (*first == '-');
+		first++;
+	}
+
+	while (first != last && '0' <= *first && *first <= '9') {
+		value = 10 * value + (*first - '0');
+		valid = true;
+		first++;
+	}
+
+	if (negative) {
+		value = -value;
+	}
+
+	return first;
+}
+
+// fast path for the common case of short decimals, where both the digits (as integer)
+// and the power of ten are exactly representable; then, one multiplication /
+// division results in the correctly rounded value, just like for strtod; all other
+// cases fall back to strtod
+char const* TokenStream::parseDouble(char const* first, char const* last, double& value, bool& valid) {
+	// powers of ten which are exactly representable as double
+	static constexpr double POW10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	static constexpr int POW10_MAX = 22;
+	static constexpr unsigned long long MANTISSA_MAX = 1ULL << 53;
+	static constexpr int DIGITS_MAX = 19;
+
+	char const* number = first;
+	char const* exp_first;
+	bool negative = false;
+	bool exp_negative = false;
+	unsigned long long mantissa = 0;
+	int digits = 0;
+	int exp10 = 0;
+	int exp_value = 0;
+	char buffer[64];
+
+	valid = false;
+
+	// sign
+	if (first != last && (*first == '+' || *first == '-')) {
+		negative = (*first == '-');
+		first++;
+	}
+
+	// integral digits
+	while (first != last && '0' <= *first && *first <= '9') {
+		if (digits < DIGITS_MAX) {
+			mantissa = 10 * mantissa + (*first - '0');
+		}
+		else {
+			exp10++;
+		}
+		digits++;
+		valid = true;
+		first++;
+	}
+
+	// fractional digits
+	if (first != last && *first == '.') {
+		first++;
+
+		while (first != last && '0' <= *first && *first <= '9') {
+			if (digits < DIGITS_MAX) {
+				mantissa = 10 * mantissa + (*first - '0');
+				exp10--;
+			}
+			digits++;
+			valid = true;
+			first++;
+		}
+	}
+
+	if (!valid) {
+		value = 0.0;
+		return first;
+	}
+
+	// exponent; only considered if followed by digits
+	if (first != last && (*first == 'e' || *first == 'E')) {
+		exp_first = first + 1;
+
+		if (exp_first != last && (*exp_first == '+' || *exp_first == '-')) {
+			exp_negative = (*exp_first == '-');
+			exp_first++;
+		}
+
+		if (exp_first != last && '0' <= *exp_first && *exp_first <= '9') {
+
+			while (exp_first != last && '0' <= *exp_first && *exp_first <= '9') {
+				if (exp_value < 10000) {
+					exp_value = 10 * exp_value + (*exp_first - '0');
+				}
+				exp_first++;
+			}
+
+			first = exp_first;
+			exp10 += exp_negative ? -exp_value : exp_value;
+		}
+	}
+
+	// fast path
+	if (digits <= DIGITS_MAX && mantissa <= MANTISSA_MAX && -POW10_MAX <= exp10 && exp10 <= POW10_MAX) {
+
+		value = static_cast<double>(mantissa);
+
+		if (exp10 < 0) {
+			value /= POW10[-exp10];
+		}
+		else {
+			value *= POW10[exp10];
+		}
+
+		if (negative) {
+			value = -value;
+		}
+	}
+	// fallback, requires null-terminated copy
+	else if (static_cast<std::size_t>(first - number) < sizeof(buffer)) {
+		std::copy(number, first, buffer);
+		buffer[first - number] = '\0';
+
+		value = std::strtod(buffer, nullptr);
+	}
+	else {
+		value = std::strtod(std::string(number, first).c_str(), nullptr);
+	}
+
+	return first;
+}
@@ -0,0 +1,164 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar memory-mapped token stream, for parsing of benchmark files
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_TOKENSTREAM
+#define _CORBLIVAR_TOKENSTREAM
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+// Whitespace-separated tokens of a file, memory-mapped as a whole; tokens are spans
+// into the mapped file, i.e., they are not copied unless explicitly required. The
+// extraction operators and eof handling resemble the ones of std::ifstream, such that
+// parsing code can use both interchangeably.
+class TokenStream {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// PODs, to be declared early on
+	public:
+		// span of one token w/in mapped file; only valid as long as the
+		// stream is open
+		struct Token {
+			char const* data = nullptr;
+			std::size_t size = 0;
+
+			inline bool operator==(char const* other) const {
+				return std::strlen(other) == this->size && std::equal(this->data, this->data + this->size, other);
+			};
+			inline bool operator!=(char const* other) const {
+				return !(*this == other);
+			};
+			inline bool operator==(std::string const& other) const {
+				return other.size() == this->size && std::equal(this->data, this->data + this->size, other.begin());
+			};
+			inline bool operator!=(std::string const& other) const {
+				return !(*this == other);
+			};
+
+			inline std::string str() const {
+				return std::string(this->data, this->size);
+			};
+
+			friend std::ostream& operator<< (std::ostream& out, Token const& token) {
+				out.write(token.data, token.size);
+				return out;
+			};
+		};
+
+	// private data, functions
+	private:
+		// mapped file, and current position w/in
+		char const* begin = nullptr;
+		char const* end = nullptr;
+		char const* pos = nullptr;
+		std::size_t mapped_size = 0;
+
+		// stream state
+		bool opened = false;
+		bool eof_flag = false;
+		bool fail_flag = false;
+
+		inline static bool whitespace(char const& c) {
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+		};
+
+		// skip whitespaces; returns false if no further token is available,
+		// i.e., eof is reached, or if extraction failed previously
+		bool skipWhitespaces();
+		// number parsing; only considers the characters w/in [first, last)
+		// matching the number syntax, returns the end of these characters
+		static char const* parseInteger(char const* first, char const* last, long long& value, bool& valid);
+		static char const* parseDouble(char const* first, char const* last, double& value, bool& valid);
+
+	// constructors, destructors, if any non-implicit
+	public:
+		TokenStream() {
+		};
+		TokenStream(TokenStream const&) = delete;
+		TokenStream& operator=(TokenStream const&) = delete;
+		~TokenStream() {
+			this->close();
+		};
+
+	// public data, functions
+	public:
+		void open(std::string const& file);
+		void close();
+
+		inline bool is_open() const {
+			return this->opened;
+		};
+		inline bool eof() const {
+			return this->eof_flag;
+		};
+		inline bool fail() const {
+			return this->fail_flag;
+		};
+		inline explicit operator bool() const {
+			return !this->fail_flag;
+		};
+
+		// raw access to mapped file
+		inline char const* data() const {
+			return this->begin;
+		};
+		inline std::size_t size() const {
+			return this->mapped_size;
+		};
+
+		// reset stream state and position to begin of file
+		inline void rewind() {
+			this->pos = this->begin;
+			this->eof_flag = this->fail_flag = false;
+		};
+
+		// number parsing for (parts of) tokens; characters not matching the
+		// number syntax are ignored, like for atof
+		inline static double toDouble(char const* first, char const* last) {
+			double value;
+			bool valid;
+
+			if (first >= last) {
+				return 0.0;
+			}
+
+			TokenStream::parseDouble(first, last, value, valid);
+
+			return value;
+		};
+		inline static double toDouble(Token const& token) {
+			return TokenStream::toDouble(token.data, token.data + token.size);
+		};
+
+		// extraction of tokens and numbers
+		TokenStream& operator>>(Token& token);
+		TokenStream& operator>>(std::string& token);
+		TokenStream& operator>>(double& value);
+		TokenStream& operator>>(int& value);
+		TokenStream& operator>>(unsigned& value);
+};
+
+#endif